@@ -40,7 +40,8 @@
 
 #include <iostream>
 #include <string>
-#include <map>
+#include <unordered_map>
+#include <vector>
 #include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
@@ -86,29 +87,52 @@ class IOPlacement {
         void forcePinSpread(bool force);
 
         void setRandomMode(int randomMode);
+        // 0 Munkres (default), 1 LAPJV, 2 Auction
+        void setAssignmentSolver(int solver);
+        // number of candidate slots kept per pin, 0 (default) keeps all
+        void setNumCandidates(unsigned numCandidates);
+        // keep the matching and duals of each run in memory and start the
+        // next run from them
+        void setWarmStart(bool enable);
+        // store the cost matrix of each section in 32 bits
+        void setCompactCosts(bool enable);
+        // multilevel mode: sections are built from clusters of up to
+        // clusterSize pins, 0 (default) uses the regular section setup
+        void setClusterSize(unsigned clusterSize);
+        // assign pins to sections by min-cost flow over the numSections
+        // cheapest sections of each pin, 0 (default) uses the greedy
+        void setFlowSections(unsigned numSections);
+        // solve again the pins within window slots of each section
+        // boundary after the sections, 0 (default) disables it
+        void setRefineWindow(unsigned window);
+        // assign all pins at once over the free slots of the whole
+        // perimeter, without sections
+        void setPerimeterSolver(bool enable);
 
         // run IOPlacement, returns a vector with all a pin name, its new
         // position and its orientation
         std::vector<Pin_t> run(bool reportHPWL = false);
 
        private:
+        // names are ids in the name table of the kernel netlist, resolved
+        // back to strings only in the results
         struct cellPin {
-                std::string name;
+                unsigned name;
                 point position;
         };
 
         struct ioPin {
-                std::string name;
+                unsigned name;
                 point position;
-                std::string netName;
+                unsigned netName;
                 box bounds;
                 std::string direction;
                 std::vector<cellPin> connections;
-                std::string locationType;
+                unsigned locationType;
         };
 
         std::vector<ioPin> _ioPins;
-        std::map<std::string, std::vector<size_t>> _mapNetToIo;
+        std::unordered_map<unsigned, std::vector<size_t>> _mapNetToIo;
 
         void initNetlist();
         void getResults(std::vector<Pin_t>& pinAssignment);
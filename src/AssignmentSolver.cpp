@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "AssignmentSolver.h"
+
+#include <algorithm>
+
+#include "Auction.h"
+#include "LAPJV.h"
+
+std::unique_ptr<AssignmentSolver> AssignmentSolver::create(SolverType type) {
+        switch (type) {
+                case SOLVER_LAPJV:
+                        return std::unique_ptr<AssignmentSolver>(
+                            new LAPJVSolver());
+                case SOLVER_AUCTION:
+                        return std::unique_ptr<AssignmentSolver>(
+                            new AuctionSolver());
+                case SOLVER_MUNKRES:
+                default:
+                        return std::unique_ptr<AssignmentSolver>(
+                            new MunkresSolver());
+        }
+}
+
+// Munkres marks the assigned pairs with 0 and every other entry with -1
+static void readAssignment(const Matrix<DBU>& matrix,
+                           std::vector<int>& assignment) {
+        assignment.assign(matrix.rows(), -1);
+        for (unsigned pin = 0; pin < matrix.rows(); ++pin) {
+                const DBU* row = matrix.row(pin);
+                for (unsigned slot = 0; slot < matrix.columns(); ++slot) {
+                        if (row[slot] == 0) {
+                                assignment[pin] = slot;
+                                break;
+                        }
+                }
+        }
+}
+
+void MunkresSolver::solve(Matrix<DBU>& matrix, std::vector<int>& assignment) {
+        _munkres.solve(matrix);
+        readAssignment(matrix, assignment);
+}
+
+void MunkresSolver::solve(Matrix<CompactCost>& matrix,
+                          std::vector<int>& assignment) {
+        const size_t size = matrix.rows() * matrix.columns();
+        _costs.assign(matrix.rows(), matrix.columns(), 0);
+        std::copy(matrix.data(), matrix.data() + size, _costs.data());
+        _munkres.solve(_costs);
+        readAssignment(_costs, assignment);
+}
+
+void MunkresSolver::reserve(unsigned numPins, unsigned numSlots) {
+        // Munkres pads the input to a square matrix
+        const size_t size = std::max(numPins, numSlots);
+        _munkres.reserve(size);
+        _costs.reserve(size * size);
+}
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __ASSIGNMENTSOLVER_H_
+#define __ASSIGNMENTSOLVER_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "munkres/munkres.h"
+
+#include "Coordinate.h"
+
+enum SolverType { SOLVER_MUNKRES, SOLVER_LAPJV, SOLVER_AUCTION };
+
+// Costs of a section normalized to 32 bits (see HungarianMatching)
+typedef int32_t CompactCost;
+
+// Solves the linear assignment problem defined by a cost matrix with one row
+// per pin and one column per slot. The solvers may use the matrix as scratch
+// space, so its contents are undefined afterwards. The result is the slot
+// (column) of each pin, or -1 for the pins left without a slot.
+class AssignmentSolver {
+       public:
+        virtual ~AssignmentSolver() = default;
+        virtual void solve(Matrix<DBU>&, std::vector<int>& assignment) = 0;
+        virtual void solve(Matrix<CompactCost>&,
+                           std::vector<int>& assignment) = 0;
+        // Allocate the buffers for sections up to the given size, so that
+        // a solver reused across sections does not allocate while solving
+        virtual void reserve(unsigned numPins, unsigned numSlots) = 0;
+
+        // Optional warm start for the next solve: the slot (matrix column)
+        // of each pin (matrix row), or -1, and the dual price of each slot.
+        // Solvers that cannot use them ignore the call.
+        virtual void setWarmStart(const std::vector<int>&,
+                                  const std::vector<DBU>&) {}
+        // Dual price of each slot after solve, false if the solver has none
+        virtual bool getSlotPrices(std::vector<DBU>&) const { return false; }
+
+        static std::unique_ptr<AssignmentSolver> create(SolverType);
+};
+
+// Reference solver, the bundled Munkres implementation. Its reductions may
+// grow beyond the input range, so compact costs are solved in 64 bits.
+class MunkresSolver : public AssignmentSolver {
+       private:
+        Munkres<DBU> _munkres;
+        Matrix<DBU> _costs;
+
+       public:
+        void solve(Matrix<DBU>&, std::vector<int>&) override;
+        void solve(Matrix<CompactCost>&, std::vector<int>&) override;
+        void reserve(unsigned numPins, unsigned numSlots) override;
+};
+
+#endif /* __ASSIGNMENTSOLVER_H_ */
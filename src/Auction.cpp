@@ -0,0 +1,304 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Auction.h"
+
+#include <algorithm>
+#include <limits>
+
+static const DBU EPSILON_FACTOR = 5;
+static const unsigned MIN_PARALLEL_BIDS = 64;
+
+template <typename Cost>
+void AuctionSolver::init(const Matrix<Cost>& matrix) {
+        const unsigned numPins = matrix.rows();
+        const unsigned numSlots = matrix.columns();
+
+        // Pins bid for slots. Sections with more slots than pins are solved
+        // without dummy pins (see reverseAuction). Only the unexpected case
+        // of missing slots is padded with zero cost slots.
+        _numRows = numPins;
+        _numCols = std::max(numSlots, numPins);
+
+        // Costs are scaled by n + 1 so that the final phase with epsilon = 1
+        // is equivalent to epsilon < 1 / n, giving the optimal assignment.
+        // The scaled costs need 64 bits, so unlike LAPJV the auction works
+        // on its own copy.
+        const DBU scale = _numRows + 1;
+        _cost.assign(_numRows * _numCols, 0);
+        for (unsigned pin = 0; pin < numPins; ++pin) {
+                const Cost* row = matrix.row(pin);
+                DBU* cost = &_cost[pin * _numCols];
+                for (unsigned slot = 0; slot < numSlots; ++slot) {
+                        cost[slot] = row[slot] * scale;
+                }
+        }
+
+        _prices.assign(_numCols, 0);
+        _rowSol.assign(_numRows, -1);
+        _colSol.assign(_numCols, -1);
+        _bidCol.assign(_numRows, -1);
+        _bidValue.assign(_numRows, 0);
+        _bestBid.assign(_numCols, 0);
+        _bestBidder.assign(_numCols, -1);
+}
+
+void AuctionSolver::reserve(unsigned numPins, unsigned numSlots) {
+        const unsigned numCols = std::max(numSlots, numPins);
+        _cost.reserve(numPins * numCols);
+        _prices.reserve(numCols);
+        _rowSol.reserve(numPins);
+        _colSol.reserve(numCols);
+        _unassigned.reserve(numPins);
+        _bidCol.reserve(numPins);
+        _bidValue.reserve(numPins);
+        _bestBid.reserve(numCols);
+        _bestBidder.reserve(numCols);
+        _touched.reserve(numCols);
+        _nextUnassigned.reserve(numPins);
+        _reverseSlots.reserve(numCols);
+}
+
+void AuctionSolver::bid(unsigned row, DBU epsilon, int& col,
+                        DBU& value) const {
+        const DBU* cost = &_cost[row * _numCols];
+        DBU min1 = std::numeric_limits<DBU>::max();
+        DBU min2 = std::numeric_limits<DBU>::max();
+        int best = 0;
+        for (unsigned j = 0; j < _numCols; ++j) {
+                DBU netCost = cost[j] + _prices[j];
+                if (netCost < min1) {
+                        min2 = min1;
+                        min1 = netCost;
+                        best = j;
+                } else if (netCost < min2) {
+                        min2 = netCost;
+                }
+        }
+        if (_numCols == 1) {
+                min2 = min1;
+        }
+
+        col = best;
+        value = _prices[best] + (min2 - min1) + epsilon;
+}
+
+void AuctionSolver::runPhase(DBU epsilon) {
+        // Keep the assignments of the previous phase that still satisfy
+        // epsilon complementary slackness; only the others bid again
+        const int numRows = _numRows;
+#pragma omp parallel for if (numRows >= (int)MIN_PARALLEL_BIDS)
+        for (int i = 0; i < numRows; ++i) {
+                int col = _rowSol[i];
+                if (col < 0) {
+                        continue;
+                }
+                const DBU* cost = &_cost[i * _numCols];
+                DBU min = std::numeric_limits<DBU>::max();
+                for (unsigned j = 0; j < _numCols; ++j) {
+                        min = std::min(min, cost[j] + _prices[j]);
+                }
+                if (cost[col] + _prices[col] > min + epsilon) {
+                        _rowSol[i] = -1;
+                }
+        }
+
+        _unassigned.clear();
+        for (unsigned col = 0; col < _numCols; ++col) {
+                int row = _colSol[col];
+                if (row >= 0 && _rowSol[row] != (int)col) {
+                        _colSol[col] = -1;
+                }
+        }
+        for (unsigned i = 0; i < _numRows; ++i) {
+                if (_rowSol[i] < 0) {
+                        _unassigned.push_back(i);
+                }
+        }
+
+        forwardAuction(epsilon);
+        reverseAuction(epsilon);
+}
+
+void AuctionSolver::forwardAuction(DBU epsilon) {
+        while (not _unassigned.empty()) {
+                const int numBids = _unassigned.size();
+
+#pragma omp parallel for if (numBids >= (int)MIN_PARALLEL_BIDS)
+                for (int k = 0; k < numBids; ++k) {
+                        bid(_unassigned[k], epsilon, _bidCol[k], _bidValue[k]);
+                }
+
+                // Highest bid wins each slot; ties go to the lowest pin
+                _touched.clear();
+                for (int k = 0; k < numBids; ++k) {
+                        int col = _bidCol[k];
+                        int row = _unassigned[k];
+                        if (_bestBidder[col] < 0) {
+                                _touched.push_back(col);
+                                _bestBidder[col] = row;
+                                _bestBid[col] = _bidValue[k];
+                        } else if (_bidValue[k] > _bestBid[col] ||
+                                   (_bidValue[k] == _bestBid[col] &&
+                                    row < _bestBidder[col])) {
+                                _bestBidder[col] = row;
+                                _bestBid[col] = _bidValue[k];
+                        }
+                }
+
+                _nextUnassigned.clear();
+                for (int k = 0; k < numBids; ++k) {
+                        int row = _unassigned[k];
+                        if (_bestBidder[_bidCol[k]] != row) {
+                                _nextUnassigned.push_back(row);
+                        }
+                }
+                for (unsigned col : _touched) {
+                        int winner = _bestBidder[col];
+                        int previous = _colSol[col];
+                        if (previous >= 0) {
+                                _rowSol[previous] = -1;
+                                _nextUnassigned.push_back(previous);
+                        }
+                        _colSol[col] = winner;
+                        _rowSol[winner] = col;
+                        _prices[col] = _bestBid[col];
+                        _bestBidder[col] = -1;
+                }
+                std::sort(_nextUnassigned.begin(), _nextUnassigned.end());
+                _unassigned.swap(_nextUnassigned);
+        }
+}
+
+void AuctionSolver::reverseAuction(DBU epsilon) {
+        // With more slots than pins, the assignment is only optimal when no
+        // free slot is more expensive than an assigned one. Free slots above
+        // the lowest assigned price lower their price until they either reach
+        // it or attract a pin, whose previous slot is then checked in turn.
+        DBU lambda = std::numeric_limits<DBU>::max();
+        std::vector<unsigned>& slots = _reverseSlots;
+        slots.clear();
+        for (unsigned col = 0; col < _numCols; ++col) {
+                if (_colSol[col] >= 0) {
+                        lambda = std::min(lambda, _prices[col]);
+                }
+        }
+        for (unsigned col = 0; col < _numCols; ++col) {
+                if (_colSol[col] < 0 && _prices[col] > lambda) {
+                        slots.push_back(col);
+                }
+        }
+
+        while (not slots.empty()) {
+                unsigned col = slots.back();
+                slots.pop_back();
+
+                // Best and second best gain of moving a pin to this slot
+                DBU max1 = std::numeric_limits<DBU>::min();
+                DBU max2 = std::numeric_limits<DBU>::min();
+                int best = 0;
+                for (unsigned i = 0; i < _numRows; ++i) {
+                        int assigned = _rowSol[i];
+                        DBU gain = _cost[i * _numCols + assigned] +
+                                   _prices[assigned] -
+                                   _cost[i * _numCols + col];
+                        if (gain > max1) {
+                                max2 = max1;
+                                max1 = gain;
+                                best = i;
+                        } else if (gain > max2) {
+                                max2 = gain;
+                        }
+                }
+                if (_numRows == 1) {
+                        max2 = max1;
+                }
+
+                if (lambda >= max1 - epsilon) {
+                        _prices[col] = lambda;
+                        continue;
+                }
+
+                int previous = _rowSol[best];
+                _prices[col] = std::max(lambda, max2 - epsilon);
+                _rowSol[best] = col;
+                _colSol[col] = best;
+                _colSol[previous] = -1;
+                if (_prices[previous] > lambda) {
+                        slots.push_back(previous);
+                }
+        }
+}
+
+template <typename Cost>
+void AuctionSolver::run(Matrix<Cost>& matrix, std::vector<int>& assignment) {
+        init(matrix);
+
+        DBU maxCost = 0;
+        for (DBU cost : _cost) {
+                maxCost = std::max(maxCost, cost);
+        }
+
+        // Epsilon scaling: coarse phases set the prices close to their final
+        // values, so the last exact phase needs few bids
+        DBU epsilon = std::max<DBU>(1, maxCost / 2);
+        while (true) {
+                runPhase(epsilon);
+                if (epsilon == 1) {
+                        break;
+                }
+                epsilon = std::max<DBU>(1, epsilon / EPSILON_FACTOR);
+        }
+
+        // Pins matched to padding slots are left without a slot
+        const int numSlots = matrix.columns();
+        assignment.assign(_rowSol.begin(), _rowSol.end());
+        for (int& slot : assignment) {
+                if (slot >= numSlots) {
+                        slot = -1;
+                }
+        }
+}
+
+void AuctionSolver::solve(Matrix<DBU>& matrix, std::vector<int>& assignment) {
+        run(matrix, assignment);
+}
+
+void AuctionSolver::solve(Matrix<CompactCost>& matrix,
+                          std::vector<int>& assignment) {
+        run(matrix, assignment);
+}
@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __AUCTION_H_
+#define __AUCTION_H_
+
+#include <vector>
+
+#include "AssignmentSolver.h"
+
+// Bertsekas auction solver with epsilon scaling. In every round all the
+// unassigned pins bid for their best slot at the same time (Jacobi bidding),
+// which is spread over the OpenMP threads; the bids are then resolved in pin
+// order, so the result does not depend on the number of threads. Sections
+// with more slots than pins need no dummy pins: a reverse auction over the
+// free slots restores the optimality conditions at the end of each phase.
+class AuctionSolver : public AssignmentSolver {
+       private:
+        unsigned _numRows;
+        unsigned _numCols;
+        std::vector<DBU> _cost;
+        std::vector<DBU> _prices;
+        std::vector<int> _rowSol;
+        std::vector<int> _colSol;
+        std::vector<unsigned> _unassigned;
+        std::vector<int> _bidCol;
+        std::vector<DBU> _bidValue;
+        std::vector<DBU> _bestBid;
+        std::vector<int> _bestBidder;
+        std::vector<unsigned> _touched;
+        std::vector<unsigned> _nextUnassigned;
+        std::vector<unsigned> _reverseSlots;
+
+        template <typename Cost>
+        void run(Matrix<Cost>&, std::vector<int>&);
+        template <typename Cost>
+        void init(const Matrix<Cost>&);
+        void runPhase(DBU);
+        void forwardAuction(DBU);
+        void reverseAuction(DBU);
+        void bid(unsigned, DBU, int&, DBU&) const;
+
+       public:
+        void solve(Matrix<DBU>&, std::vector<int>&) override;
+        void solve(Matrix<CompactCost>&, std::vector<int>&) override;
+        void reserve(unsigned numPins, unsigned numSlots) override;
+};
+
+#endif /* __AUCTION_H_ */
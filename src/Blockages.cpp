@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Blockages.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+void Blockages::add(const Coordinate& initial, const Coordinate& final) {
+        Coordinate lower(std::min(initial.getX(), final.getX()),
+                         std::min(initial.getY(), final.getY()));
+        Coordinate upper(std::max(initial.getX(), final.getX()),
+                         std::max(initial.getY(), final.getY()));
+        _areas.push_back(std::make_pair(lower, upper));
+}
+
+bool Blockages::read(const std::string& file, unsigned& line) {
+        line = 0;
+        std::ifstream in(file);
+        if (not in.is_open()) {
+                return false;
+        }
+
+        std::string text;
+        while (std::getline(in, text)) {
+                ++line;
+                if (text.find_first_not_of(" \t\r") == std::string::npos) {
+                        continue;
+                }
+                std::istringstream fields(text);
+                std::string extra;
+                DBU initialX, initialY, finalX, finalY;
+                if (not(fields >> initialX >> initialY >> finalX >> finalY) ||
+                    fields >> extra ||
+                    not fitsCoordinateWidth(initialX, initialY) ||
+                    not fitsCoordinateWidth(finalX, finalY)) {
+                        return false;
+                }
+                add(Coordinate(initialX, initialY),
+                    Coordinate(finalX, finalY));
+        }
+        return true;
+}
+
+void Blockages::build(const Core& core) {
+        const DBU lbX = core.getLowerBound().getX();
+        const DBU lbY = core.getLowerBound().getY();
+        const DBU ubX = core.getUpperBound().getX();
+        const DBU ubY = core.getUpperBound().getY();
+        for (std::vector<Interval>& edge : _edges) {
+                edge.clear();
+        }
+
+        for (const std::pair<Coordinate, Coordinate>& area : _areas) {
+                const DBU minX = area.first.getX();
+                const DBU minY = area.first.getY();
+                const DBU maxX = area.second.getX();
+                const DBU maxY = area.second.getY();
+                if (minY <= lbY && lbY <= maxY) {
+                        _edges[EDGE_BOTTOM].push_back({minX, maxX});
+                }
+                if (minX <= ubX && ubX <= maxX) {
+                        _edges[EDGE_RIGHT].push_back({minY, maxY});
+                }
+                if (minY <= ubY && ubY <= maxY) {
+                        _edges[EDGE_TOP].push_back({minX, maxX});
+                }
+                if (minX <= lbX && lbX <= maxX) {
+                        _edges[EDGE_LEFT].push_back({minY, maxY});
+                }
+        }
+
+        for (std::vector<Interval>& edge : _edges) {
+                std::sort(edge.begin(), edge.end(),
+                          [](const Interval& a, const Interval& b) {
+                                  return a.begin < b.begin;
+                          });
+                unsigned numMerged = 0;
+                for (const Interval& interval : edge) {
+                        if (numMerged > 0 &&
+                            interval.begin <= edge[numMerged - 1].end) {
+                                edge[numMerged - 1].end = std::max(
+                                    edge[numMerged - 1].end, interval.end);
+                        } else {
+                                edge[numMerged++] = interval;
+                        }
+                }
+                edge.resize(numMerged);
+        }
+}
+
+void Blockages::markSlots(slotVector_t& slots) const {
+        for (int edge = EDGE_BOTTOM; edge <= EDGE_LEFT; ++edge) {
+                const std::vector<Interval>& intervals = _edges[edge];
+                const bool horizontal = edge == EDGE_BOTTOM || edge == EDGE_TOP;
+                const unsigned begin = slots.edgeBegin(Edge(edge));
+                const unsigned end = slots.edgeEnd(Edge(edge));
+                auto coordOf = [&](unsigned slot) {
+                        Coordinate pos = slots.pos(slot);
+                        return horizontal ? pos.getX() : pos.getY();
+                };
+
+                // The intervals are disjoint and sorted, so the one that may
+                // hold the next slot only moves forward along the walk: up
+                // the bottom and right edges, down the top and left ones
+                if (edge == EDGE_BOTTOM || edge == EDGE_RIGHT) {
+                        unsigned k = 0;
+                        for (unsigned slot = begin; slot < end; ++slot) {
+                                const DBU t = coordOf(slot);
+                                while (k < intervals.size() &&
+                                       intervals[k].end < t) {
+                                        ++k;
+                                }
+                                slots.setBlocked(
+                                    slot, k < intervals.size() &&
+                                              intervals[k].begin <= t);
+                        }
+                } else {
+                        int k = intervals.size() - 1;
+                        for (unsigned slot = begin; slot < end; ++slot) {
+                                const DBU t = coordOf(slot);
+                                while (k >= 0 && intervals[k].begin > t) {
+                                        --k;
+                                }
+                                slots.setBlocked(
+                                    slot, k >= 0 && intervals[k].end >= t);
+                        }
+                }
+        }
+}
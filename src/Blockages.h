@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BLOCKAGES_H_
+#define __BLOCKAGES_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Coordinate.h"
+#include "Core.h"
+#include "Slots.h"
+
+// Areas where no IO pin may be placed, from the blockage file, the DEF and
+// the library API. A slot is blocked when an area contains it, so each area
+// becomes a blocked interval on every core edge it crosses. The intervals
+// of an edge are kept sorted and merged, and the slots of an edge are
+// marked in one sweep: O(S + B log B) instead of testing every area for
+// every slot.
+class Blockages {
+       private:
+        struct Interval {
+                DBU begin;
+                DBU end;
+        };
+        std::vector<std::pair<Coordinate, Coordinate>> _areas;
+        std::vector<Interval> _edges[4];
+
+       public:
+        void clear() { _areas.clear(); }
+        unsigned size() const { return _areas.size(); }
+
+        // Corners in any order
+        void add(const Coordinate&, const Coordinate&);
+        // Text file, one "initialX initialY finalX finalY" line per area,
+        // added to the current areas. Returns false if the file cannot be
+        // opened (line 0) or at the first malformed or out of range line,
+        // stored in line.
+        bool read(const std::string&, unsigned& line);
+
+        // Sorted and merged intervals of each edge of the core
+        void build(const Core&);
+        // Marks the slots inside the areas as blocked
+        void markSlots(slotVector_t&) const;
+};
+
+#endif /* __BLOCKAGES_H_ */
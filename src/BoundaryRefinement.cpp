@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "BoundaryRefinement.h"
+
+#include <algorithm>
+#include <omp.h>
+
+#include "CostKernel.h"
+
+BoundaryRefinement::BoundaryRefinement(slotVector_t& slots,
+                                       const sectionVector_t& sections,
+                                       unsigned window)
+    : _slots(slots), _window(window) {
+        _bounds.push_back(0);
+        for (const Section_t& section : sections) {
+                if (section.beginSlot > 0 &&
+                    section.beginSlot < _slots.size()) {
+                        _bounds.push_back(section.beginSlot);
+                }
+        }
+        _bounds.push_back(_slots.size());
+        std::sort(_bounds.begin(), _bounds.end());
+        _bounds.erase(std::unique(_bounds.begin(), _bounds.end()),
+                      _bounds.end());
+}
+
+DBU BoundaryRefinement::refineWindow(unsigned bound,
+                                     std::vector<AssignedPin>& pins,
+                                     std::vector<IOPin>& assignment,
+                                     unsigned offset, SolverWorkspace& ws,
+                                     WindowBuffers& buffers) {
+        const unsigned boundary = _bounds[bound];
+        const unsigned begin = std::max(_bounds[bound - 1],
+                                        boundary - std::min(boundary, _window));
+        const unsigned end = std::min(_bounds[bound + 1], boundary + _window);
+
+        buffers.pins.clear();
+        buffers.slots.clear();
+        buffers.current.clear();
+        for (unsigned slot = begin; slot < end; ++slot) {
+                if (_unavailable[slot]) {
+                        continue;
+                }
+                if (_pinAtSlot[slot] >= 0) {
+                        buffers.pins.push_back(_pinAtSlot[slot]);
+                        buffers.current.push_back(buffers.slots.size());
+                }
+                buffers.slots.push_back(slot);
+        }
+        if (buffers.pins.empty()) {
+                return 0;
+        }
+
+        CostData& data = ws.costData;
+        data.clear();
+        for (unsigned slot : buffers.slots) {
+                data.addSlot(_slots.pos(slot));
+        }
+        for (unsigned pin : buffers.pins) {
+                data.addNet(pins[pin].net->getSinksBB(pins[pin].idx));
+        }
+        Matrix<DBU>& costs = ws.costs;
+        costs.resize(buffers.pins.size(), buffers.slots.size());
+        for (unsigned k = 0; k < buffers.pins.size(); ++k) {
+                CostKernel::computeRow(data, k, costs.row(k));
+        }
+
+        // The solver overwrites the costs, so both sides of the comparison
+        // are evaluated with the same function afterwards
+        ws.solver->solve(costs, buffers.assignment);
+        DBU before = 0;
+        DBU after = 0;
+        for (unsigned k = 0; k < buffers.pins.size(); ++k) {
+                const AssignedPin& pin = pins[buffers.pins[k]];
+                unsigned current = buffers.slots[buffers.current[k]];
+                unsigned slot = buffers.slots[buffers.assignment[k]];
+                before += pin.net->computeIONetHPWL(pin.idx,
+                                                    _slots.pos(current));
+                after += pin.net->computeIONetHPWL(pin.idx, _slots.pos(slot));
+        }
+        if (after >= before) {
+                return 0;
+        }
+
+        for (unsigned pin : buffers.pins) {
+                _slots.setUsed(pins[pin].slot, false);
+                _pinAtSlot[pins[pin].slot] = -1;
+        }
+        for (unsigned k = 0; k < buffers.pins.size(); ++k) {
+                AssignedPin& pin = pins[buffers.pins[k]];
+                unsigned slot = buffers.slots[buffers.assignment[k]];
+                const Coordinate pos = _slots.pos(slot);
+                _slots.setUsed(slot, true);
+                _pinAtSlot[slot] = buffers.pins[k];
+                pin.slot = slot;
+                pin.net->setPos(pin.idx, pos);
+                assignment[offset + buffers.pins[k]].setPos(pos);
+        }
+        return before - after;
+}
+
+DBU BoundaryRefinement::run(std::vector<AssignedPin>& pins,
+                            std::vector<IOPin>& assignment, unsigned offset) {
+        _pinAtSlot.assign(_slots.size(), -1);
+        for (unsigned k = 0; k < pins.size(); ++k) {
+                _pinAtSlot[pins[k].slot] = k;
+        }
+        // Windows of the same parity are disjoint in slots but may share
+        // words of the used bitset, so the windows never read the bitset.
+        // Slots of pins outside the list (none at this point) are kept.
+        _unavailable.assign(_slots.size(), 0);
+        for (unsigned slot = 0; slot < _slots.size(); ++slot) {
+                _unavailable[slot] =
+                    _slots.isBlocked(slot) ||
+                    (_slots.isUsed(slot) && _pinAtSlot[slot] < 0);
+        }
+
+        std::vector<SolverWorkspace> workspaces(omp_get_max_threads());
+        std::vector<WindowBuffers> buffers(workspaces.size());
+        for (SolverWorkspace& ws : workspaces) {
+                ws.init(SOLVER_LAPJV, 2 * _window, 2 * _window);
+        }
+
+        // Interior bounds only; a window stays within the sections around
+        // its boundary, so windows of the same parity are disjoint
+        DBU gain = 0;
+        const int numBounds = _bounds.size() - 1;
+        for (int parity = 1; parity <= 2; ++parity) {
+#pragma omp parallel for schedule(dynamic) reduction(+ : gain)
+                for (int bound = parity; bound < numBounds; bound += 2) {
+                        int thread = omp_get_thread_num();
+                        gain += refineWindow(bound, pins, assignment, offset,
+                                             workspaces[thread],
+                                             buffers[thread]);
+                }
+        }
+        return gain;
+}
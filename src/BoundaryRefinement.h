@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BOUNDARYREFINEMENT_H_
+#define __BOUNDARYREFINEMENT_H_
+
+#include <vector>
+
+#include "Slots.h"
+#include "SolverWorkspace.h"
+
+// Post-pass over the final assignment. Sections are solved independently,
+// so the pins next to a section boundary never see the slots of the
+// neighbouring section. A window covers up to `window` slots on each side
+// of a boundary, within the two sections around it, and its pins are
+// matched again over its free and used slots with LAPJV. A window only
+// commits a matching that lowers the HPWL of its nets; each IO net has a
+// single IO pin, so the delta only depends on the pins of the window.
+// Windows of even boundaries never overlap and run in parallel, then the
+// odd ones.
+class BoundaryRefinement {
+       private:
+        struct WindowBuffers {
+                std::vector<unsigned> pins;
+                std::vector<unsigned> slots;
+                std::vector<unsigned> current;
+                std::vector<int> assignment;
+        };
+
+        slotVector_t& _slots;
+        unsigned _window;
+        // First slot of each section, then the number of slots
+        std::vector<unsigned> _bounds;
+        // Index in the pin list of the pin on each slot, or -1
+        std::vector<int> _pinAtSlot;
+        // Blocked slots and slots of pins outside the list, taken before
+        // the parallel loop
+        std::vector<char> _unavailable;
+
+        DBU refineWindow(unsigned bound, std::vector<AssignedPin>&,
+                         std::vector<IOPin>&, unsigned offset,
+                         SolverWorkspace&, WindowBuffers&);
+
+       public:
+        BoundaryRefinement(slotVector_t&, const sectionVector_t&,
+                           unsigned window);
+        // pins[k] is the pin written at assignment[offset + k]. Returns the
+        // HPWL reduction.
+        DBU run(std::vector<AssignedPin>& pins, std::vector<IOPin>& assignment,
+                unsigned offset);
+};
+
+#endif /* __BOUNDARYREFINEMENT_H_ */
@@ -44,3 +44,16 @@ DBU Coordinate::dst(Coordinate a) {
         DBU ay = a.getY();
         return std::sqrt(std::pow(_x - ax, 2) + std::pow(_y - ay, 2));
 }
+
+bool fitsCoordinateWidth(DBU x, DBU y) {
+        return x >= -MAX_COORDINATE && x <= MAX_COORDINATE &&
+               y >= -MAX_COORDINATE && y <= MAX_COORDINATE;
+}
+
+bool fitsDieWidth(DBU lowerX, DBU lowerY, DBU upperX, DBU upperY) {
+        if (not fitsCoordinateWidth(lowerX, lowerY) ||
+            not fitsCoordinateWidth(upperX, upperY)) {
+                return false;
+        }
+        return (upperX - lowerX) + (upperY - lowerY) <= MAX_DIE_HALF_PERIMETER;
+}
@@ -38,22 +38,59 @@
 #ifndef __COORDINATE_H_
 #define __COORDINATE_H_
 
+#include <cassert>
+#include <cstdint>
+#include <limits>
+
+// Distances, HPWL, costs and their sums
 typedef long long int DBU;
 
+// Storage width of positions. Builds with IOPLACER_DBU32 (cmake -DDBU32=ON)
+// keep coordinates in 32 bits, which halves Coordinate, Box, the netlist
+// sinks and the cost kernel inputs. Positions are widened to DBU when read,
+// so arithmetic does not change; the loaders check every position they read.
+#ifdef IOPLACER_DBU32
+typedef int32_t CoordDBU;
+#else
+typedef long long int CoordDBU;
+#endif
+
+// Largest magnitude of a loaded position. Within it the x plus y distance
+// between any two positions fits CoordDBU, so the 32-bit cost kernels
+// cannot overflow.
+static const DBU MAX_COORDINATE = std::numeric_limits<CoordDBU>::max() / 4;
+
+// Largest die half perimeter such that the HPWL of any net inside it fits
+// CoordDBU with headroom, so that costs of a row also fit 32-bit matrices
+static const DBU MAX_DIE_HALF_PERIMETER =
+    std::numeric_limits<CoordDBU>::max() / 2;
+
 class Coordinate {
-        DBU _x, _y;
+        CoordDBU _x, _y;
+
+        // Values are range checked when loaded; debug builds catch the rest
+        static CoordDBU narrow(const DBU value) {
+                assert(CoordDBU(value) == value);
+                return CoordDBU(value);
+        }
 
        public:
-        Coordinate(const DBU x, const DBU y) : _x(x), _y(y) {}
+        Coordinate(const DBU x, const DBU y) : _x(narrow(x)), _y(narrow(y)) {}
         void init(const DBU x, const DBU y) {
-                _x = x;
-                _y = y;
+                _x = narrow(x);
+                _y = narrow(y);
         }
-        void setX(const DBU x) { _x = x; }
-        void setY(const DBU y) { _y = y; }
+        void setX(const DBU x) { _x = narrow(x); }
+        void setY(const DBU y) { _y = narrow(y); }
         DBU getX() const { return _x; }
         DBU getY() const { return _y; }
         DBU dst(Coordinate);
 };
 
+// True if both values are within MAX_COORDINATE
+bool fitsCoordinateWidth(DBU x, DBU y);
+// True if both corners fit and the half perimeter of the die is at most
+// MAX_DIE_HALF_PERIMETER
+bool fitsDieWidth(DBU lowerX, DBU lowerY, DBU upperX, DBU upperY);
+
 #endif /* __COORDINATE_H_ */
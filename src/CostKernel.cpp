@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "CostKernel.h"
+
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COSTKERNEL_X86
+#include <immintrin.h>
+#endif
+
+void CostData::clear() {
+        slotX.clear();
+        slotY.clear();
+        minX.clear();
+        minY.clear();
+        maxX.clear();
+        maxY.clear();
+}
+
+void CostData::reserve(unsigned numPins, unsigned numSlots) {
+        slotX.reserve(numSlots);
+        slotY.reserve(numSlots);
+        minX.reserve(numPins);
+        minY.reserve(numPins);
+        maxX.reserve(numPins);
+        maxY.reserve(numPins);
+}
+
+void CostData::addSlot(const Coordinate& pos) {
+        slotX.push_back(pos.getX());
+        slotY.push_back(pos.getY());
+}
+
+void CostData::addNet(const Box& box) {
+        minX.push_back(box.getLowerBound().getX());
+        minY.push_back(box.getLowerBound().getY());
+        maxX.push_back(box.getUpperBound().getX());
+        maxY.push_back(box.getUpperBound().getY());
+}
+
+static void computeRowScalar(const CostData& data, unsigned pin, DBU* row,
+                             unsigned begin) {
+        const DBU minX = data.minX[pin];
+        const DBU minY = data.minY[pin];
+        const DBU maxX = data.maxX[pin];
+        const DBU maxY = data.maxY[pin];
+        const CoordDBU* slotX = data.slotX.data();
+        const CoordDBU* slotY = data.slotY.data();
+        for (unsigned slot = begin; slot < data.numSlots(); ++slot) {
+                const DBU x = slotX[slot];
+                const DBU y = slotY[slot];
+                row[slot] = (std::max(maxX, x) - std::min(minX, x)) +
+                            (std::max(maxY, y) - std::min(minY, y));
+        }
+}
+
+#if defined(COSTKERNEL_X86) && not defined(IOPLACER_DBU32)
+// AVX2 has no 64-bit min/max, so they are built from compare and blend
+__attribute__((target("avx2"))) static void computeRowAVX2(
+    const CostData& data, unsigned pin, DBU* row) {
+        const __m256i minX = _mm256_set1_epi64x(data.minX[pin]);
+        const __m256i minY = _mm256_set1_epi64x(data.minY[pin]);
+        const __m256i maxX = _mm256_set1_epi64x(data.maxX[pin]);
+        const __m256i maxY = _mm256_set1_epi64x(data.maxY[pin]);
+        const CoordDBU* slotX = data.slotX.data();
+        const CoordDBU* slotY = data.slotY.data();
+        const unsigned numSlots = data.numSlots();
+        unsigned slot = 0;
+        for (; slot + 4 <= numSlots; slot += 4) {
+                __m256i x = _mm256_loadu_si256((const __m256i*)(slotX + slot));
+                __m256i y = _mm256_loadu_si256((const __m256i*)(slotY + slot));
+                __m256i hiX = _mm256_blendv_epi8(
+                    maxX, x, _mm256_cmpgt_epi64(x, maxX));
+                __m256i loX = _mm256_blendv_epi8(
+                    minX, x, _mm256_cmpgt_epi64(minX, x));
+                __m256i hiY = _mm256_blendv_epi8(
+                    maxY, y, _mm256_cmpgt_epi64(y, maxY));
+                __m256i loY = _mm256_blendv_epi8(
+                    minY, y, _mm256_cmpgt_epi64(minY, y));
+                __m256i cost = _mm256_add_epi64(_mm256_sub_epi64(hiX, loX),
+                                                _mm256_sub_epi64(hiY, loY));
+                _mm256_storeu_si256((__m256i*)(row + slot), cost);
+        }
+        computeRowScalar(data, pin, row, slot);
+}
+
+__attribute__((target("avx512f"))) static void computeRowAVX512(
+    const CostData& data, unsigned pin, DBU* row) {
+        const __m512i minX = _mm512_set1_epi64(data.minX[pin]);
+        const __m512i minY = _mm512_set1_epi64(data.minY[pin]);
+        const __m512i maxX = _mm512_set1_epi64(data.maxX[pin]);
+        const __m512i maxY = _mm512_set1_epi64(data.maxY[pin]);
+        const CoordDBU* slotX = data.slotX.data();
+        const CoordDBU* slotY = data.slotY.data();
+        const unsigned numSlots = data.numSlots();
+        unsigned slot = 0;
+        for (; slot + 8 <= numSlots; slot += 8) {
+                __m512i x = _mm512_loadu_si512(slotX + slot);
+                __m512i y = _mm512_loadu_si512(slotY + slot);
+                __m512i dx = _mm512_sub_epi64(_mm512_max_epi64(maxX, x),
+                                              _mm512_min_epi64(minX, x));
+                __m512i dy = _mm512_sub_epi64(_mm512_max_epi64(maxY, y),
+                                              _mm512_min_epi64(minY, y));
+                _mm512_storeu_si512(row + slot, _mm512_add_epi64(dx, dy));
+        }
+        computeRowScalar(data, pin, row, slot);
+}
+#elif defined(COSTKERNEL_X86)
+// 32-bit coordinates: the loaders bound the die half perimeter, so a cost
+// fits 32 bits and is only widened to DBU when stored
+__attribute__((target("avx2"))) static void computeRowAVX2(
+    const CostData& data, unsigned pin, DBU* row) {
+        const __m256i minX = _mm256_set1_epi32(data.minX[pin]);
+        const __m256i minY = _mm256_set1_epi32(data.minY[pin]);
+        const __m256i maxX = _mm256_set1_epi32(data.maxX[pin]);
+        const __m256i maxY = _mm256_set1_epi32(data.maxY[pin]);
+        const CoordDBU* slotX = data.slotX.data();
+        const CoordDBU* slotY = data.slotY.data();
+        const unsigned numSlots = data.numSlots();
+        unsigned slot = 0;
+        for (; slot + 8 <= numSlots; slot += 8) {
+                __m256i x = _mm256_loadu_si256((const __m256i*)(slotX + slot));
+                __m256i y = _mm256_loadu_si256((const __m256i*)(slotY + slot));
+                __m256i dx = _mm256_sub_epi32(_mm256_max_epi32(maxX, x),
+                                              _mm256_min_epi32(minX, x));
+                __m256i dy = _mm256_sub_epi32(_mm256_max_epi32(maxY, y),
+                                              _mm256_min_epi32(minY, y));
+                __m256i cost = _mm256_add_epi32(dx, dy);
+                _mm256_storeu_si256(
+                    (__m256i*)(row + slot),
+                    _mm256_cvtepi32_epi64(_mm256_castsi256_si128(cost)));
+                _mm256_storeu_si256(
+                    (__m256i*)(row + slot + 4),
+                    _mm256_cvtepi32_epi64(_mm256_extracti128_si256(cost, 1)));
+        }
+        computeRowScalar(data, pin, row, slot);
+}
+
+__attribute__((target("avx512f"))) static void computeRowAVX512(
+    const CostData& data, unsigned pin, DBU* row) {
+        const __m512i minX = _mm512_set1_epi32(data.minX[pin]);
+        const __m512i minY = _mm512_set1_epi32(data.minY[pin]);
+        const __m512i maxX = _mm512_set1_epi32(data.maxX[pin]);
+        const __m512i maxY = _mm512_set1_epi32(data.maxY[pin]);
+        const CoordDBU* slotX = data.slotX.data();
+        const CoordDBU* slotY = data.slotY.data();
+        const unsigned numSlots = data.numSlots();
+        unsigned slot = 0;
+        for (; slot + 16 <= numSlots; slot += 16) {
+                __m512i x = _mm512_loadu_si512(slotX + slot);
+                __m512i y = _mm512_loadu_si512(slotY + slot);
+                __m512i dx = _mm512_sub_epi32(_mm512_max_epi32(maxX, x),
+                                              _mm512_min_epi32(minX, x));
+                __m512i dy = _mm512_sub_epi32(_mm512_max_epi32(maxY, y),
+                                              _mm512_min_epi32(minY, y));
+                __m512i cost = _mm512_add_epi32(dx, dy);
+                _mm512_storeu_si512(
+                    row + slot,
+                    _mm512_cvtepi32_epi64(_mm512_castsi512_si256(cost)));
+                _mm512_storeu_si512(
+                    row + slot + 8,
+                    _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(cost, 1)));
+        }
+        computeRowScalar(data, pin, row, slot);
+}
+#endif
+
+typedef void (*RowFunction)(const CostData&, unsigned, DBU*);
+
+static void computeRowGeneric(const CostData& data, unsigned pin, DBU* row) {
+        computeRowScalar(data, pin, row, 0);
+}
+
+struct RowKernel {
+        RowFunction function;
+        const char* name;
+};
+
+static RowKernel selectKernel() {
+#ifdef COSTKERNEL_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+                return {computeRowAVX512, "avx512"};
+        }
+        if (__builtin_cpu_supports("avx2")) {
+                return {computeRowAVX2, "avx2"};
+        }
+#endif
+        return {computeRowGeneric, "scalar"};
+}
+
+// Selected on first use; static initialization is thread safe
+static const RowKernel& kernel() {
+        static const RowKernel selected = selectKernel();
+        return selected;
+}
+
+void CostKernel::computeRow(const CostData& data, unsigned pin, DBU* row) {
+        kernel().function(data, pin, row);
+}
+
+const char* CostKernel::isaName() { return kernel().name; }
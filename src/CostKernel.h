@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __COSTKERNEL_H_
+#define __COSTKERNEL_H_
+
+#include <vector>
+
+#include "Box.h"
+#include "Coordinate.h"
+
+// Inputs of the cost matrix of a section in structure-of-arrays layout: the
+// position of each non-blocked slot (one per column) and the bounding box of
+// the sinks of each pin (one per row). The HPWL of a pin at a slot is the
+// half perimeter of its box extended by the slot position.
+struct CostData {
+        std::vector<CoordDBU> slotX;
+        std::vector<CoordDBU> slotY;
+        std::vector<CoordDBU> minX;
+        std::vector<CoordDBU> minY;
+        std::vector<CoordDBU> maxX;
+        std::vector<CoordDBU> maxY;
+
+        void clear();
+        void reserve(unsigned numPins, unsigned numSlots);
+        void addSlot(const Coordinate&);
+        // Inverted boxes (nets without sinks) cost zero at every slot
+        void addNet(const Box&);
+        unsigned numSlots() const { return slotX.size(); }
+};
+
+// Computes a whole row of the cost matrix. The vector width (AVX-512, AVX2 or
+// scalar) is chosen once from the running CPU; all versions use the same
+// integer operations, so the costs are identical on every machine and for
+// any number of threads. With 32-bit coordinates the vector versions work on
+// twice as many slots per instruction and widen the costs when storing.
+class CostKernel {
+       public:
+        static void computeRow(const CostData&, unsigned pin, DBU* row);
+        static const char* isaName();
+};
+
+#endif /* __COSTKERNEL_H_ */
@@ -10,8 +10,10 @@
 #include "dbShape.h"
 #include "Coordinate.h"
 
-DBWrapper::DBWrapper(Netlist& netlist, Core& core, Parameters& parms) : 
-                _netlist(&netlist), _core(&core), _parms(&parms) {
+DBWrapper::DBWrapper(Netlist& netlist, Core& core, Blockages& blockages,
+                     Parameters& parms) : 
+                _netlist(&netlist), _core(&core), _blockages(&blockages),
+                _parms(&parms) {
         _db = odb::dbDatabase::create();
 }
 
@@ -33,9 +35,54 @@ void DBWrapper::parseDEF(const std::string &filename) {
         _chip = defReader.createChip(searchLibs, filename.c_str());
 }
 
+// Positions outside the coordinate range of the build would wrap around
+static void checkCoordinate(const char* what, DBU x, DBU y) {
+        if (!fitsCoordinateWidth(x, y)) {
+                std::cout << "[ERROR] " << what << " at (" << x << ", " << y
+                          << ") exceeds the " << 8 * sizeof(CoordDBU)
+                          << "-bit coordinate range of this build! Exiting...\n";
+                std::exit(1);
+        }
+}
+
 void DBWrapper::populateIOPlacer() {
         initNetlist();
         initCore();
+        initBlockages();
+}
+
+void DBWrapper::initBlockages() {
+        odb::dbBlock* block = _chip->getBlock();
+        if (!block) {
+                std::cout << "[ERROR] odb::dbBlock not found! Exiting...\n";
+                std::exit(1);
+        }
+
+        // Placement blockages, and routing blockages on the pin layers
+        for (odb::dbBlockage* blockage : block->getBlockages()) {
+                odb::dbBox* box = blockage->getBBox();
+                checkCoordinate("Blockage", box->xMin(), box->yMin());
+                checkCoordinate("Blockage", box->xMax(), box->yMax());
+                _blockages->add(Coordinate(box->xMin(), box->yMin()),
+                                Coordinate(box->xMax(), box->yMax()));
+        }
+
+        odb::dbTech* tech = _db->getTech();
+        odb::dbTechLayer* horLayer =
+            tech->findRoutingLayer(_parms->getHorizontalMetalLayer());
+        odb::dbTechLayer* verLayer =
+            tech->findRoutingLayer(_parms->getVerticalMetalLayer());
+        for (odb::dbObstruction* obstruction : block->getObstructions()) {
+                odb::dbBox* box = obstruction->getBBox();
+                odb::dbTechLayer* layer = box->getTechLayer();
+                if (layer != horLayer && layer != verLayer) {
+                        continue;
+                }
+                checkCoordinate("Obstruction", box->xMin(), box->yMin());
+                checkCoordinate("Obstruction", box->xMax(), box->yMax());
+                _blockages->add(Coordinate(box->xMin(), box->yMin()),
+                                Coordinate(box->xMax(), box->yMax()));
+        }
 }
 
 
@@ -55,6 +102,12 @@ void DBWrapper::initCore() {
         }
 
         odb::dbBox* coreBBox = block->getBBox();
+        if (!fitsDieWidth(coreBBox->xMin(), coreBBox->yMin(),
+                          coreBBox->xMax(), coreBBox->yMax())) {
+                std::cout << "[ERROR] Die exceeds the " << 8 * sizeof(CoordDBU)
+                          << "-bit coordinate range of this build! Exiting...\n";
+                std::exit(1);
+        }
 
         Coordinate lowerBound(coreBBox->xMin(), coreBBox->yMin());
         Coordinate upperBound(coreBBox->xMax(), coreBBox->yMax());
@@ -155,12 +208,14 @@ void DBWrapper::initNetlist() {
                 int xPos = 0;
                 int yPos = 0;
                 curBTerm->getFirstPinLocation( xPos, yPos );
+                checkCoordinate("Pin", xPos, yPos);
                
                 Coordinate bounds(0, 0);
-                IOPin ioPin( curBTerm->getConstName(), 
+                IOPin ioPin( _netlist->intern(curBTerm->getConstName()), 
                              Coordinate(xPos, yPos), 
-                             dir, bounds, bounds, net->getConstName(),
-                             "FIXED" );
+                             dir, bounds, bounds,
+                             _netlist->intern(net->getConstName()),
+                             _netlist->intern("FIXED") );
 
                 std::vector<InstancePin> instPins;
                 odb::dbSet<odb::dbITerm> iterms = net->getITerms();
@@ -170,8 +225,10 @@ void DBWrapper::initNetlist() {
                         odb::dbInst* inst = curITerm->getInst();
                         int instX = 0, instY = 0;
                         inst->getLocation(instX, instY);
+                        checkCoordinate("Instance", instX, instY);
                         
-                        instPins.push_back(InstancePin(inst->getConstName(), 
+                        NameId instName = _netlist->intern(inst->getConstName());
+                        instPins.push_back(InstancePin(instName, 
                                                        Coordinate(instX, instY)));
                 }
 
@@ -209,7 +266,8 @@ void DBWrapper::commitIOPlacementToDB(std::vector<IOPin>& assignment) {
 
 
         for (IOPin& pin: assignment) {
-                odb::dbBTerm* bterm = block->findBTerm(pin.getName().c_str());
+                const std::string& name = _netlist->getName(pin.getName());
+                odb::dbBTerm* bterm = block->findBTerm(name.c_str());
                 odb::dbSet<odb::dbBPin> bpins = bterm->getBPins();
                 odb::dbSet<odb::dbBPin>::iterator bpinIter;
                 std::vector<odb::dbBPin*> allBPins;
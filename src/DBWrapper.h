@@ -40,6 +40,7 @@
 #define DBWRAPPER_h
 
 #include <string>
+#include "Blockages.h"
 #include "Netlist.h"
 #include "Parameters.h"
 #include "Core.h"
@@ -55,7 +56,8 @@ class dbTechLayer;
 class DBWrapper {
 public:
         DBWrapper() = default;
-        DBWrapper(Netlist& netlist, Core& core, Parameters& parms);
+        DBWrapper(Netlist& netlist, Core& core, Blockages& blockages,
+                  Parameters& parms);
 
         void parseLEF(const std::string &filename);
         void parseDEF(const std::string &filename);
@@ -67,11 +69,13 @@ private:
         void initCore();
         void initNetlist();
         void initTracks();
+        void initBlockages();
 
         odb::dbDatabase *_db;
         odb::dbChip     *_chip;
         Netlist         *_netlist = nullptr;
         Core            *_core = nullptr;
+        Blockages       *_blockages = nullptr;
         Parameters      *_parms = nullptr;
         bool            _verbose = false;
 };
@@ -37,8 +37,21 @@
 
 #include "HungarianMatching.h"
 
-HungarianMatching::HungarianMatching(Section_t& section, slotVector_t& slots)
-    : _netlist(section.net), _slots(slots) {
+#include <algorithm>
+#include <limits>
+#include <omp.h>
+
+HungarianMatching::HungarianMatching(Section_t& section, slotVector_t& slots,
+                                     SolverType solverType,
+                                     unsigned numCandidates,
+                                     const WarmStart* warmStart,
+                                     bool compactCosts)
+    : _netlist(section.net),
+      _slots(slots),
+      _solverType(solverType),
+      _numCandidates(numCandidates),
+      _warmStart(warmStart),
+      _compactCosts(compactCosts) {
         _numIOPins = _netlist.numIOPins();
         _beginSlot = section.beginSlot;
         _endSlot = section.endSlot;
@@ -46,59 +59,231 @@ HungarianMatching::HungarianMatching(Section_t& section, slotVector_t& slots)
         _nonBlockedSlots = section.numSlots;
 }
 
-void HungarianMatching::run() {
-        createMatrix();
-        _hungarianSolver.solve(_hungarianMatrix);
+// Largest normalized cost of the compact mode, leaving headroom so that the
+// solvers can add reduced costs without overflow
+static const DBU MAX_COMPACT_COST =
+    std::numeric_limits<CompactCost>::max() / 2;
+
+void HungarianMatching::run(SolverWorkspace& workspace) {
+        initSlotIndexes();
+        initCostData(workspace.costData);
+
+        unsigned numCandidates = _numCandidates;
+        while (numCandidates > 0 && numCandidates < _nonBlockedSlots) {
+                createSparseMatrix(workspace, numCandidates);
+                if (workspace.sparseSolver.solve(workspace.sparseMatrix,
+                                                 _slotOfPin)) {
+                        _slotPrices.clear();
+                        return;
+                }
+                // The candidates of some pins ran out, retry with more
+                numCandidates *= 2;
+        }
+
+        // The matrices belong to the workspace and are overwritten by the
+        // next section, only the matching is kept
+        AssignmentSolver& solver = *workspace.solver;
+        if (_warmStart != nullptr && not _warmStart->empty()) {
+                initWarmStart(workspace);
+        }
+        if (createCompactMatrix(workspace.costData, workspace.compactCosts)) {
+                solver.solve(workspace.compactCosts, _slotOfPin);
+        } else {
+                createMatrix(workspace.costData, workspace.costs);
+                solver.solve(workspace.costs, _slotOfPin);
+        }
+        if (not solver.getSlotPrices(_slotPrices)) {
+                _slotPrices.clear();
+        }
 }
 
-void HungarianMatching::createMatrix() {
-        _hungarianMatrix = Matrix<DBU>(_nonBlockedSlots, _numIOPins);
-        unsigned slotIndex = 0;
+void HungarianMatching::initWarmStart(SolverWorkspace& workspace) {
+        // Slots are matched by position, since the sections of the previous
+        // run may have been split differently
+        std::vector<int>& slots = workspace.initSlots;
+        std::vector<DBU>& prices = workspace.initPrices;
+        slots.assign(_numIOPins, -1);
+        prices.assign(_slotIndexes.size(), 0);
+        Coordinate pos(0, 0);
+        DBU price = 0;
+        _netlist.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
+                const std::string& name = _netlist.getName(ioPin.getName());
+                if (not _warmStart->find(name, pos, price)) {
+                        return;
+                }
+                int slot = _slots.indexOf(pos);
+                if (slot < 0) {
+                        return;
+                }
+                auto it = std::lower_bound(_slotIndexes.begin(),
+                                           _slotIndexes.end(), slot);
+                if (it != _slotIndexes.end() && *it == (unsigned)slot) {
+                        int column = it - _slotIndexes.begin();
+                        slots[idx] = column;
+                        prices[column] = price;
+                }
+        });
+        workspace.solver->setWarmStart(slots, prices);
+}
+
+void HungarianMatching::initSlotIndexes() {
+        _slotIndexes.clear();
+        for (int i = _slots.findNextFree(_beginSlot);
+             i >= 0 && (unsigned)i < _endSlot; i = _slots.findNextFree(i + 1)) {
+                _slotIndexes.push_back(i);
+        }
+}
+
+void HungarianMatching::initCostData(CostData& data) {
+        data.clear();
+        for (unsigned slot : _slotIndexes) {
+                data.addSlot(_slots.pos(slot));
+        }
+        for (unsigned pin = 0; pin < _numIOPins; ++pin) {
+                data.addNet(_netlist.getSinksBB(pin));
+        }
+}
+
+// Sections with fewer costs build their matrix in a single task
+static const size_t MIN_SPLIT_COSTS = 1 << 16;
+static const int ROWS_PER_TASK = 16;
+
+// Calls func for each row (pin) of the cost matrix. Inside a section task,
+// the rows of large sections become subtasks that idle threads can take, so
+// the last big sections do not leave the other threads waiting. Outside of a
+// parallel region (auction mode) the rows are split among all threads.
+template <typename Func>
+static void forEachRow(int numRows, size_t numCosts, Func func) {
+        if (omp_in_parallel()) {
+#pragma omp taskloop grainsize(ROWS_PER_TASK) if (numCosts >= MIN_SPLIT_COSTS)
+                for (int row = 0; row < numRows; ++row) {
+                        func(row);
+                }
+        } else {
 #pragma omp parallel for
-        for (unsigned i = _beginSlot; i < _endSlot; ++i) {
-                unsigned pinIndex = 0;
-                Coordinate newPos = _slots[i].pos;
-                if (_slots[i].blocked) {
-                        continue;
+                for (int row = 0; row < numRows; ++row) {
+                        func(row);
                 }
-                _netlist.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
-                        DBU hpwl = _netlist.computeIONetHPWL(idx, newPos);
-                        _hungarianMatrix(slotIndex, pinIndex) = hpwl;
-                        pinIndex++;
-                });
-                slotIndex++;
         }
 }
 
-inline bool samePos(Coordinate& a, Coordinate& b) {
-        return (a.getX() == b.getX() && a.getY() == b.getY());
+void HungarianMatching::createMatrix(const CostData& data,
+                                     Matrix<DBU>& matrix) {
+        // One row per pin, so each task writes its own rows
+        const unsigned numSlots = _slotIndexes.size();
+        const int numPins = _numIOPins;
+        matrix.assign(numPins, numSlots, 0);
+        forEachRow(numPins, (size_t)numPins * numSlots, [&](int pin) {
+                CostKernel::computeRow(data, pin, matrix.row(pin));
+        });
+}
+
+bool HungarianMatching::createCompactMatrix(const CostData& data,
+                                            Matrix<CompactCost>& matrix) {
+        // Padding slots cost zero, which is only neutral without
+        // normalization, so sections short of slots keep 64-bit costs
+        const unsigned numSlots = _slotIndexes.size();
+        if (not _compactCosts || _numIOPins > numSlots) {
+                return false;
+        }
+
+        // Subtracting a constant from the costs of a pin changes neither the
+        // optimal assignment nor the slot prices, so each row is normalized
+        // by its minimum, which usually leaves a range that fits 32 bits
+        const int numPins = _numIOPins;
+        matrix.assign(numPins, numSlots, 0);
+        bool fits = true;
+        forEachRow(numPins, (size_t)numPins * numSlots, [&](int pin) {
+                // Kept by each thread of the pool across sections
+                static thread_local std::vector<DBU> costs;
+                costs.resize(numSlots);
+                CostKernel::computeRow(data, pin, costs.data());
+                auto range = std::minmax_element(costs.begin(), costs.end());
+                DBU min = *range.first;
+                if (*range.second - min > MAX_COMPACT_COST) {
+#pragma omp atomic write
+                        fits = false;
+                        return;
+                }
+                CompactCost* row = matrix.row(pin);
+                for (unsigned slot = 0; slot < numSlots; ++slot) {
+                        row[slot] = costs[slot] - min;
+                }
+        });
+        return fits;
+}
+
+void HungarianMatching::createSparseMatrix(SolverWorkspace& workspace,
+                                           unsigned numCandidates) {
+        // Keep only the numCandidates cheapest slots of each pin
+        std::vector<DBU>& row = workspace.costRow;
+        auto& costs = workspace.slotCosts;
+        std::vector<unsigned>& candidates = workspace.candidates;
+        std::vector<DBU>& candidateCosts = workspace.candidateCosts;
+        row.resize(_slotIndexes.size());
+        costs.resize(_slotIndexes.size());
+        candidates.resize(numCandidates);
+        candidateCosts.resize(numCandidates);
+        workspace.sparseMatrix.clear(_numIOPins, _slotIndexes.size());
+        for (unsigned pin = 0; pin < _numIOPins; ++pin) {
+                CostKernel::computeRow(workspace.costData, pin, row.data());
+                for (unsigned slot = 0; slot < _slotIndexes.size(); ++slot) {
+                        costs[slot] = std::make_pair(row[slot], slot);
+                }
+                std::nth_element(costs.begin(),
+                                 costs.begin() + numCandidates - 1,
+                                 costs.end());
+                for (unsigned k = 0; k < numCandidates; ++k) {
+                        candidateCosts[k] = costs[k].first;
+                        candidates[k] = costs[k].second;
+                }
+                workspace.sparseMatrix.addPin(candidates, candidateCosts);
+        }
 }
 
-void HungarianMatching::getFinalAssignment(std::vector<IOPin>& assigment) {
-        size_t rows = _hungarianMatrix.rows();
-        size_t col = 0;
-        unsigned slotIndex = 0;
+void HungarianMatching::getWarmStart(WarmStart& warmStart) {
         _netlist.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
-                slotIndex = _beginSlot;
-                for (size_t row = 0; row < rows; row++) {
-                        while (_slots[slotIndex].blocked &&
-                               slotIndex < _slots.size())
-                                slotIndex++;
-                        if (_hungarianMatrix(row, col) != 0) {
-                                slotIndex++;
-                                continue;
-                        }
-                        ioPin.setPos(_slots[slotIndex].pos);
-                        assigment.push_back(ioPin);
-                        Coordinate sPos = _slots[slotIndex].pos;
-                        for (unsigned i = 0; i < _slots.size(); i++) {
-                                if (samePos(_slots[i].pos, sPos)) {
-                                        _slots[i].used = true;
-                                        break;
-                                }
-                        }
-                        break;
+                int slot = _slotOfPin[idx];
+                if (slot < 0) {
+                        return;
+                }
+                DBU price = 0;
+                if (slot < (int)_slotPrices.size()) {
+                        price = _slotPrices[slot];
+                }
+                warmStart.add(_netlist.getName(ioPin.getName()),
+                              _slots.pos(_slotIndexes[slot]), price);
+        });
+}
+
+unsigned HungarianMatching::numAssigned() const {
+        return std::count_if(_slotOfPin.begin(), _slotOfPin.end(),
+                             [](int slot) { return slot >= 0; });
+}
+
+void HungarianMatching::getFinalAssignment(std::vector<IOPin>& assignment,
+                                           unsigned offset) {
+        // Writes numAssigned() pins from assignment[offset] on. Sections
+        // own disjoint slot ranges, so they can be committed in parallel.
+        _netlist.forEachIOPin([&](unsigned idx, const IOPin& ioPin) {
+                int slot = _slotOfPin[idx];
+                if (slot < 0) {
+                        return;
                 }
-                col++;
+                const Coordinate pos = _slots.pos(_slotIndexes[slot]);
+                _netlist.setPos(idx, pos);
+                assignment[offset] = ioPin;
+                assignment[offset++].setPos(pos);
+                _slots.setUsed(_slotIndexes[slot], true);
         });
 }
+
+void HungarianMatching::getAssignedPins(std::vector<AssignedPin>& pins,
+                                        unsigned offset) {
+        for (unsigned idx = 0; idx < _slotOfPin.size(); ++idx) {
+                int slot = _slotOfPin[idx];
+                if (slot >= 0) {
+                        pins[offset++] = {&_netlist, idx, _slotIndexes[slot]};
+                }
+        }
+}
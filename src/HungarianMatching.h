@@ -40,30 +40,55 @@
 
 #include "munkres/munkres.h"
 
+#include "AssignmentSolver.h"
 #include "Coordinate.h"
 #include "Netlist.h"
 #include "IOPlacementKernel.h"
 #include "Slots.h"
+#include "SolverWorkspace.h"
+#include "WarmStart.h"
 
 class HungarianMatching {
        private:
-        Matrix<DBU> _hungarianMatrix;
-        Munkres<DBU> _hungarianSolver;
-        Netlist& _netlist;
+        NetlistView& _netlist;
         slotVector_t& _slots;
         unsigned _beginSlot;
         unsigned _endSlot;
         unsigned _numSlots;
         unsigned _numIOPins;
         unsigned _nonBlockedSlots;
+        SolverType _solverType;
+        unsigned _numCandidates;
+        std::vector<unsigned> _slotIndexes;
+        std::vector<int> _slotOfPin;
+        const WarmStart* _warmStart;
+        bool _compactCosts;
+        std::vector<DBU> _slotPrices;
 
-        void createMatrix();
+        void initSlotIndexes();
+        void initCostData(CostData&);
+        void createMatrix(const CostData&, Matrix<DBU>&);
+        bool createCompactMatrix(const CostData&, Matrix<CompactCost>&);
+        void createSparseMatrix(SolverWorkspace&, unsigned);
+        void initWarmStart(SolverWorkspace&);
 
        public:
-        HungarianMatching(Section_t&, slotVector_t&);
-        virtual ~HungarianMatching() = default;
-        void run();
-        void getFinalAssignment(std::vector<IOPin>&);
+        HungarianMatching(Section_t&, slotVector_t&, SolverType,
+                          unsigned numCandidates = 0,
+                          const WarmStart* warmStart = nullptr,
+                          bool compactCosts = false);
+        HungarianMatching(const HungarianMatching&) = delete;
+        HungarianMatching(HungarianMatching&&) = default;
+        void run(SolverWorkspace&);
+        unsigned numIOPins() const { return _numIOPins; }
+        unsigned numSlots() const { return _numSlots; }
+        // Work estimate used to schedule the sections
+        size_t predictedCost() const { return (size_t)_numIOPins * _numSlots; }
+        unsigned numAssigned() const;
+        void getFinalAssignment(std::vector<IOPin>&, unsigned offset);
+        // Same pins and order as getFinalAssignment
+        void getAssignedPins(std::vector<AssignedPin>&, unsigned offset);
+        void getWarmStart(WarmStart&);
 };
 
 #endif /* __HUNGARIANMATCHING_H_ */
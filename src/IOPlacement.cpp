@@ -44,10 +44,27 @@ namespace ioPlacer {
 
 IOPlacementKernel ioKernel;
 
+// Positions outside the coordinate range of the build would wrap around
+static void checkCoordinate(const char* what, const point& pos) {
+        if (not fitsCoordinateWidth(pos.x(), pos.y())) {
+                std::cout << "ERROR: " << what << " at (" << pos.x() << ", "
+                          << pos.y() << ") exceeds the "
+                          << 8 * sizeof(CoordDBU)
+                          << "-bit coordinate range of this build\n";
+                exit(-1);
+        }
+}
+
 void IOPlacement::initCore(point lowerBounds, point upperBounds,
                            DBU minSpacingX, DBU minSpacingY, DBU initTrackX,
                            DBU initTrackY, DBU minAreaX, DBU minAreaY,
                            DBU minWidthX, DBU minWidthY, DBU databaseUnit) {
+        if (not fitsDieWidth(lowerBounds.x(), lowerBounds.y(),
+                             upperBounds.x(), upperBounds.y())) {
+                std::cout << "ERROR: Die exceeds the " << 8 * sizeof(CoordDBU)
+                          << "-bit coordinate range of this build\n";
+                exit(-1);
+        }
         Coordinate lowerBound(lowerBounds.x(), lowerBounds.y());
         Coordinate upperBound(upperBounds.x(), upperBounds.y());
         ioKernel._core = Core(lowerBound, upperBound, minSpacingX, minSpacingY,
@@ -65,23 +82,33 @@ void IOPlacement::setMetalLayers(int horizontalMetalLayer,
 
 void IOPlacement::addIOPin(std::string name, std::string netName, box bounds,
                            std::string direction) {
+        Netlist& netlist = ioKernel._netlist;
         ioPin pin;
-        pin.name = name;
+        pin.name = netlist.intern(name);
         pin.position = point(0, 0);
-        pin.netName = netName;
+        pin.netName = netlist.intern(netName);
         pin.bounds = bounds;
         pin.direction = direction;
+        pin.locationType = netlist.intern("");
         _ioPins.push_back(pin);
         size_t idx = _ioPins.size() - 1;
-        _mapNetToIo[netName].push_back(idx);
+        _mapNetToIo[pin.netName].push_back(idx);
 }
 
 void IOPlacement::addInstPin(std::string net, std::string pinName, point pos) {
+        Netlist& netlist = ioKernel._netlist;
+        // Nets without IO pins are not interned
+        NameId netId = netlist.getNameTable().find(net);
+        auto it = _mapNetToIo.find(netId);
+        if (it == _mapNetToIo.end()) {
+                return;
+        }
+
         cellPin pin;
-        pin.name = pinName;
+        pin.name = netlist.intern(pinName);
         pin.position = pos;
 
-        std::vector<size_t>& index = _mapNetToIo[net];
+        std::vector<size_t>& index = it->second;
         for (size_t& i : index) {
                 _ioPins[i].connections.push_back(pin);
         }
@@ -104,8 +131,7 @@ void IOPlacement::addBlockage(point initialPos, point finalPos) {
         finalY = std::min(finalY, coreUpperBound.getY());
         Coordinate initialCoord(initialX, initialY);
         Coordinate finalCoord(finalX, finalY);
-        std::pair<Coordinate, Coordinate> block(initialCoord, finalCoord);
-        ioKernel._blockagesArea.push_back(block);
+        ioKernel._blockages.add(initialCoord, finalCoord);
 }
 
 void IOPlacement::initNetlist() {
@@ -118,20 +144,23 @@ void IOPlacement::initNetlist() {
                         dir = DIR_INOUT;
                 }
 
+                checkCoordinate("Pin", io.position);
+                checkCoordinate("Pin bound", io.bounds.min_corner());
+                checkCoordinate("Pin bound", io.bounds.max_corner());
                 Coordinate lowerBound(_ioPins[i].bounds.min_corner().x(),
                                       _ioPins[i].bounds.min_corner().y());
                 Coordinate upperBound(_ioPins[i].bounds.max_corner().x(),
                                       _ioPins[i].bounds.max_corner().y());
 
-                std::string netName = _ioPins[i].netName;
                 Coordinate pos(_ioPins[i].position.x(),
                                _ioPins[i].position.y());
 
-                IOPin ioPin(io.name, pos, dir, lowerBound, upperBound, netName,
-                            io.locationType);
+                IOPin ioPin(io.name, pos, dir, lowerBound, upperBound,
+                            io.netName, io.locationType);
                 std::vector<InstancePin> instPins;
                 for (unsigned j = 0; j < io.connections.size(); ++j) {
                         cellPin& cellPin = io.connections[j];
+                        checkCoordinate("Instance pin", cellPin.position);
                         instPins.push_back(InstancePin(
                             cellPin.name, Coordinate(cellPin.position.x(),
                                                      cellPin.position.y())));
@@ -140,6 +169,7 @@ void IOPlacement::initNetlist() {
                 io.connections.clear();
         }
         _ioPins.clear();
+        _mapNetToIo.clear();
 }
 
 char IOPlacement::getOrientationString(int orient) {
@@ -152,7 +182,7 @@ char IOPlacement::getOrientationString(int orient) {
 void IOPlacement::getResults(std::vector<Pin_t>& pinAssignment) {
         for (IOPin& io : ioKernel._assignment) {
                 Pin_t p;
-                p.name = io.getName();
+                p.name = ioKernel._netlist.getName(io.getName());
                 p.pos = point(io.getX(), io.getY());
                 const Orientation& orient = io.getOrientation();
                 p.orientation = getOrientationString(orient);
@@ -180,6 +210,38 @@ void IOPlacement::setRandomMode(int randomMode) {
         ioKernel._randomMode = (RandomMode)randomMode;
 }
 
+void IOPlacement::setAssignmentSolver(int solver) {
+        ioKernel._solverType = (SolverType)solver;
+}
+
+void IOPlacement::setNumCandidates(unsigned numCandidates) {
+        ioKernel._numCandidates = numCandidates;
+}
+
+void IOPlacement::setWarmStart(bool enable) {
+        ioKernel._warmStart = enable;
+}
+
+void IOPlacement::setCompactCosts(bool enable) {
+        ioKernel._compactCosts = enable;
+}
+
+void IOPlacement::setClusterSize(unsigned clusterSize) {
+        ioKernel._clusterSize = clusterSize;
+}
+
+void IOPlacement::setFlowSections(unsigned numSections) {
+        ioKernel._flowSections = numSections;
+}
+
+void IOPlacement::setRefineWindow(unsigned window) {
+        ioKernel._refineWindow = window;
+}
+
+void IOPlacement::setPerimeterSolver(bool enable) {
+        ioKernel._perimeterSolver = enable;
+}
+
 std::vector<Pin_t> IOPlacement::run(bool reportHPWL) {
         initNetlist();
         ioKernel._reportHPWL = reportHPWL;
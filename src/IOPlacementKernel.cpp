@@ -35,7 +35,8 @@
 // POSSIBILITY OF SUCH DAMAGE.
 ////////////////////////////////////////////////////////////////////////////////
 
-#include <random>
+#include <cmath>
+#include <numeric>
 #include <omp.h>
 
 #include "IOPlacementKernel.h"
@@ -49,11 +50,26 @@ void IOPlacementKernel::initNetlistAndCore() {
                 _dbWrapper.parseDEF(_parms->getInputDefFile()); 
         }
 
+        _blockages.clear();
         _dbWrapper.populateIOPlacer();
 
         if (_parms->getBlockagesFile().size() != 0) {
                 _blockagesFile = _parms->getBlockagesFile();
         }
+        unsigned line = 0;
+        if (_blockagesFile.size() != 0 &&
+            not _blockages.read(_blockagesFile, line)) {
+                if (line == 0) {
+                        std::cout << "ERROR: could not read blockages file "
+                                  << _blockagesFile << "\n";
+                } else {
+                        std::cout << "ERROR: malformed or out of range "
+                                  << "blockage in "
+                                  << _blockagesFile << ", line " << line
+                                  << "\n";
+                }
+                exit(1);
+        }
 }
 
 void IOPlacementKernel::initParms() {
@@ -81,6 +97,34 @@ void IOPlacementKernel::initParms() {
         if (_parms->getRandomMode() > -1) {
                 _randomMode = (RandomMode)_parms->getRandomMode();
         }
+        if (_parms->getAssignmentSolver() > -1) {
+                _solverType = (SolverType)_parms->getAssignmentSolver();
+        }
+        if (_parms->getNumCandidates() > -1) {
+                _numCandidates = _parms->getNumCandidates();
+        }
+        if (_parms->getWarmStartFile().size() != 0) {
+                _warmStartFile = _parms->getWarmStartFile();
+                _warmStart = true;
+        }
+        if (_parms->getWarmStart()) {
+                _warmStart = true;
+        }
+        if (_parms->getCompactCosts()) {
+                _compactCosts = true;
+        }
+        if (_parms->getClusterSize() > -1) {
+                _clusterSize = _parms->getClusterSize();
+        }
+        if (_parms->getFlowSections() > -1) {
+                _flowSections = _parms->getFlowSections();
+        }
+        if (_parms->getRefineWindow() > -1) {
+                _refineWindow = _parms->getRefineWindow();
+        }
+        if (_parms->getPerimeterSolver()) {
+                _perimeterSolver = true;
+        }
         if (_forcePinSpread && (_randomMode > 0)) {
                 std::cout << "WARNING: force pin spread option has no effect"
                           << " when using random pin placement\n";
@@ -88,144 +132,108 @@ void IOPlacementKernel::initParms() {
 }
 
 IOPlacementKernel::IOPlacementKernel(Parameters& parms)
-    : _parms(&parms), _dbWrapper(_netlist, _core, parms) {
+    : _parms(&parms), _dbWrapper(_netlist, _core, _blockages, parms) {
 }
 
 #endif  // STANDALONE_MODE
 
 void IOPlacementKernel::randomPlacement(const RandomMode mode) {
-        const double seed = _parms->getRandSeed();
+        const Philox random(uint64_t(_parms->getRandSeed()));
+
+        std::vector<unsigned> freeSlots;
+        for (int slot = _slots.findNextFree(0); slot >= 0;
+             slot = _slots.findNextFree(slot + 1)) {
+                freeSlots.push_back(slot);
+        }
 
         unsigned numIOs = _netlist.numIOPins();
-        unsigned numSlots = _slots.size();
-        double shift = numSlots / double(numIOs);
-        unsigned mid1 = numSlots * 1 / 8 - numIOs / 8;
-        unsigned mid2 = numSlots * 3 / 8 - numIOs / 8;
-        unsigned mid3 = numSlots * 5 / 8 - numIOs / 8;
-        unsigned mid4 = numSlots * 7 / 8 - numIOs / 8;
-        unsigned idx = 0;
-        unsigned slotsPerEdge = numIOs / 4;
-        unsigned lastSlots = (numIOs - slotsPerEdge * 3);
-        std::vector<int> vSlots(numSlots);
-        std::vector<int> vIOs(numIOs);
-
-        std::vector<InstancePin> instPins;
-        _netlist.forEachSinkOfIO(
-            idx, [&](InstancePin& instPin) { instPins.push_back(instPin); });
-        if (_sections.size() < 1) {
-                Section_t s = {Coordinate(0, 0)};
-                _sections.push_back(s);
+        unsigned numSlots = freeSlots.size();
+        if (numSlots < numIOs) {
+                std::cout << "ERROR: number of pins (" << numIOs
+                          << ") exceed free slots (" << numSlots << ")\n";
+                exit(1);
         }
 
+        // Pin idx goes to the free slot slotOfIO[idx]
+        std::vector<unsigned> slotOfIO(numIOs);
+        std::vector<unsigned> perm;
         switch (mode) {
                 case RandomMode::Full:
                         std::cout << "RandomMode Full\n";
-                        for (size_t i = 0; i < vSlots.size(); ++i) {
-                                vSlots[i] = i;
+                        random.permutation(numSlots, perm);
+                        for (unsigned idx = 0; idx < numIOs; ++idx) {
+                                slotOfIO[idx] = perm[idx];
                         }
-                        std::shuffle(vSlots.begin(), vSlots.end(),
-                                     std::default_random_engine(seed));
-                        _netlist.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
-                                unsigned b = vSlots[0];
-                                ioPin.setPos(_slots.at(b).pos);
-                                _assignment.push_back(ioPin);
-                                _sections[0].net.addIONet(ioPin, instPins);
-                                vSlots.erase(vSlots.begin());
-                        });
                         break;
-                case RandomMode::Even:
+                case RandomMode::Even: {
                         std::cout << "RandomMode Even\n";
-                        for (size_t i = 0; i < vIOs.size(); ++i) vIOs[i] = i;
-                        std::shuffle(vIOs.begin(), vIOs.end(),
-                                     std::default_random_engine(seed));
-                        _netlist.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
-                                unsigned b = vIOs[0];
-                                ioPin.setPos(_slots.at(floor(b * shift)).pos);
-                                _assignment.push_back(ioPin);
-                                _sections[0].net.addIONet(ioPin, instPins);
-                                vIOs.erase(vIOs.begin());
-                        });
+                        double shift = numSlots / double(numIOs);
+                        random.permutation(numIOs, perm);
+                        for (unsigned idx = 0; idx < numIOs; ++idx) {
+                                slotOfIO[idx] = floor(perm[idx] * shift);
+                        }
                         break;
-                case RandomMode::Group:
+                }
+                case RandomMode::Group: {
                         std::cout << "RandomMode Group\n";
-                        for (size_t i = mid1; i < mid1 + slotsPerEdge; i++) {
-                                vIOs[idx++] = i;
-                        }
-                        for (size_t i = mid2; i < mid2 + slotsPerEdge; i++) {
-                                vIOs[idx++] = i;
+                        unsigned slotsPerEdge = numIOs / 4;
+                        unsigned lastSlots = (numIOs - slotsPerEdge * 3);
+                        std::vector<unsigned> group;
+                        for (unsigned edge = 0; edge < 4; ++edge) {
+                                unsigned mid = numSlots * (2 * edge + 1) / 8 -
+                                               numIOs / 8;
+                                unsigned count =
+                                    edge < 3 ? slotsPerEdge : lastSlots;
+                                for (unsigned i = mid; i < mid + count; i++) {
+                                        group.push_back(i);
+                                }
                         }
-                        for (size_t i = mid3; i < mid3 + slotsPerEdge; i++) {
-                                vIOs[idx++] = i;
+                        random.permutation(numIOs, perm);
+                        for (unsigned idx = 0; idx < numIOs; ++idx) {
+                                slotOfIO[idx] = group[perm[idx]];
                         }
-                        for (size_t i = mid4; i < mid4 + lastSlots; i++) {
-                                vIOs[idx++] = i;
-                        }
-                        std::shuffle(vIOs.begin(), vIOs.end(),
-                                     std::default_random_engine(seed));
-                        _netlist.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
-                                unsigned b = vIOs[0];
-                                ioPin.setPos(_slots.at(b).pos);
-                                _assignment.push_back(ioPin);
-                                _sections[0].net.addIONet(ioPin, instPins);
-                                vIOs.erase(vIOs.begin());
-                        });
                         break;
+                }
                 default:
                         std::cout << "ERROR: Random mode not found\n";
                         exit(-1);
                         break;
         }
+
+        // A single section keeps the pins and their sinks for the HPWL
+        // report
+        _sections.clear();
+        _sections.push_back({Coordinate(0, 0)});
+        NetlistView& net = _sections[0].net;
+        net = NetlistView(_netlist);
+        for (unsigned idx = 0; idx < numIOs; ++idx) {
+                net.addIONet(idx);
+        }
+
+        const unsigned firstAssigned = _assignment.size();
+        _assignment.resize(firstAssigned + numIOs);
+#pragma omp parallel for
+        for (unsigned idx = 0; idx < numIOs; ++idx) {
+                unsigned slot = freeSlots[slotOfIO[idx]];
+                net.setPos(idx, _slots.pos(slot));
+                _slots.setUsed(slot, true);
+                _assignment[firstAssigned + idx] = net.getIOPin(idx);
+                _assignment[firstAssigned + idx].setPos(net.getPos(idx));
+        }
 }
 
 void IOPlacementKernel::initIOLists() {
+        _netlistIOPins = NetlistView(_netlist);
         _netlist.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
-                std::vector<InstancePin> instPinsVector;
                 if (_netlist.numSinksOfIO(idx) != 0) {
-                        _netlist.forEachSinkOfIO(idx,
-                                                 [&](InstancePin& instPin) {
-                                instPinsVector.push_back(instPin);
-                        });
-                        _netlistIOPins.addIONet(ioPin, instPinsVector);
+                        _netlistIOPins.addIONet(idx);
                 } else {
                         _zeroSinkIOs.push_back(ioPin);
                 }
         });
 }
 
-inline bool IOPlacementKernel::checkBlocked(DBU currX, DBU currY) {
-        DBU blockedBeginX;
-        DBU blockedBeginY;
-        DBU blockedEndX;
-        DBU blockedEndY;
-        for (std::pair<Coordinate, Coordinate> blockage : _blockagesArea) {
-                blockedBeginX = std::get<0>(blockage).getX();
-                blockedBeginY = std::get<0>(blockage).getY();
-                blockedEndX = std::get<0>(blockage).getX();
-                blockedEndY = std::get<0>(blockage).getY();
-                if (currX >= blockedBeginX)
-                        if (currY >= blockedBeginY)
-                                if (currX <= blockedEndX)
-                                        if (currY <= blockedEndY) return true;
-        }
-        return false;
-}
-
 void IOPlacementKernel::defineSlots() {
-        Coordinate lb = _core.getLowerBound();
-        Coordinate ub = _core.getUpperBound();
-        DBU lbX = lb.getX();
-        DBU lbY = lb.getY();
-        DBU ubX = ub.getX();
-        DBU ubY = ub.getY();
-        unsigned minDstPinsX = _core.getMinDstPinsX();
-        unsigned minDstPinsY = _core.getMinDstPinsY();
-        unsigned initTracksX = _core.getInitTracksX();
-        unsigned initTracksY = _core.getInitTracksY();
-
-        DBU totalNumSlots = 0;
-        totalNumSlots += (ubX - lbX) * 2 / minDstPinsX;
-        totalNumSlots += (ubY - lbY) * 2 / minDstPinsY;
-
         /*******************************************
          * How the for bellow follows core boundary *
          ********************************************
@@ -244,77 +252,9 @@ void IOPlacementKernel::defineSlots() {
          *                 ---->                    *
          *******************************************/
 
-        std::vector<Coordinate> slotsEdge1;
-        DBU currX = initTracksX;
-        DBU currY = lb.getY();
-
-        while (currX < ub.getX()) {
-                Coordinate pos(currX, currY);
-                slotsEdge1.push_back(pos);
-                currX += minDstPinsX;
-        }
-
-        std::vector<Coordinate> slotsEdge2;
-        currY = initTracksY;
-        currX = ub.getX();
-        while (currY < ub.getY()) {
-                Coordinate pos(currX, currY);
-                slotsEdge2.push_back(pos);
-                currY += minDstPinsY;
-        }
-
-        std::vector<Coordinate> slotsEdge3;
-        currX = initTracksX;
-        currY = ub.getY();
-        while (currX < ub.getX()) {
-                Coordinate pos(currX, currY);
-                slotsEdge3.push_back(pos);
-                currX += minDstPinsX;
-        }
-        std::reverse(slotsEdge3.begin(), slotsEdge3.end());
-
-        std::vector<Coordinate> slotsEdge4;
-        currY = initTracksY;
-        currX = lb.getX();
-        while (currY < ub.getY()) {
-                Coordinate pos(currX, currY);
-                slotsEdge4.push_back(pos);
-                currY += minDstPinsY;
-        }
-        std::reverse(slotsEdge4.begin(), slotsEdge4.end());
-
-        int i = 0;
-        for (Coordinate pos : slotsEdge1) {
-                currX = pos.getX();
-                currY = pos.getY();
-                bool blocked = checkBlocked(currX, currY);
-                _slots.push_back({blocked, false, Coordinate(currX, currY)});
-                i++;
-        }
-
-        for (Coordinate pos : slotsEdge2) {
-                currX = pos.getX();
-                currY = pos.getY();
-                bool blocked = checkBlocked(currX, currY);
-                _slots.push_back({blocked, false, Coordinate(currX, currY)});
-                i++;
-        }
-
-        for (Coordinate pos : slotsEdge3) {
-                currX = pos.getX();
-                currY = pos.getY();
-                bool blocked = checkBlocked(currX, currY);
-                _slots.push_back({blocked, false, Coordinate(currX, currY)});
-                i++;
-        }
-
-        for (Coordinate pos : slotsEdge4) {
-                currX = pos.getX();
-                currY = pos.getY();
-                bool blocked = checkBlocked(currX, currY);
-                _slots.push_back({blocked, false, Coordinate(currX, currY)});
-                i++;
-        }
+        _slots.init(_core);
+        _blockages.build(_core);
+        _blockages.markSlots(_slots);
 }
 
 void IOPlacementKernel::createSections() {
@@ -324,18 +264,13 @@ void IOPlacementKernel::createSections() {
         unsigned beginSlot = 0;
         unsigned endSlot = 0;
         while (endSlot < numSlots) {
-                int blockedSlots = 0;
                 endSlot = beginSlot + _slotsPerSection - 1;
                 if (endSlot > numSlots) {
                         endSlot = numSlots;
                 }
-                for (unsigned i = beginSlot; i < endSlot; ++i) {
-                        if (slots[i].blocked) {
-                                blockedSlots++;
-                        }
-                }
                 unsigned midPoint = (endSlot - beginSlot) / 2;
-                Section_t nSec = {slots.at(beginSlot + midPoint).pos};
+                Section_t nSec = {slots.pos(beginSlot + midPoint)};
+                nSec.net = NetlistView(_netlist);
                 if (_usagePerSection > 1.f) {
                         std::cout << "WARNING: section usage exeeded max\n";
                         _usagePerSection = 1.;
@@ -348,7 +283,7 @@ void IOPlacementKernel::createSections() {
                                 _slotsPerSection *= 1.1;
                         }
                 }
-                nSec.numSlots = endSlot - beginSlot - blockedSlots;
+                nSec.numSlots = slots.countFree(beginSlot, endSlot);
                 if (nSec.numSlots < 0) {
                         std::cout << "ERROR: negative number of slots\n";
                         exit(-1);
@@ -363,24 +298,22 @@ void IOPlacementKernel::createSections() {
 }
 
 bool IOPlacementKernel::assignPinsSections() {
-        Netlist& net = _netlistIOPins;
+        if (_flowSections > 0) {
+                return assignPinsSectionsFlow();
+        }
+        NetlistView& net = _netlistIOPins;
         sectionVector_t& sections = _sections;
         createSections();
+        _sectionIndex.build(sections);
         int totalPinsAssigned = 0;
         net.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
                 bool pinAssigned = false;
-                std::vector<DBU> dst(sections.size());
-                std::vector<InstancePin> instPinsVector;
-#pragma omp parallel for
-                for (unsigned i = 0; i < sections.size(); i++) {
-                        dst[i] = net.computeIONetHPWL(idx, sections[i].pos);
-                }
-                net.forEachSinkOfIO(idx, [&](InstancePin& instPin) {
-                        instPinsVector.push_back(instPin);
-                });
-                for (auto i : sort_indexes(dst)) {
+                _sectionIndex.begin(net, idx);
+                for (int i = _sectionIndex.next(); i >= 0;
+                     i = _sectionIndex.next()) {
                         if (sections[i].curSlots < sections[i].maxSlots) {
-                                sections[i].net.addIONet(ioPin, instPinsVector);
+                                sections[i].net.addIONet(
+                                    net.netlistIdx(idx));
                                 sections[i].curSlots++;
                                 pinAssigned = true;
                                 totalPinsAssigned++;
@@ -403,16 +336,218 @@ bool IOPlacementKernel::assignPinsSections() {
         }
 }
 
+void IOPlacementKernel::assignPinsPerimeter() {
+        // A single section over the whole boundary, so the HPWL report and
+        // the rest of the flow see the pins as usual
+        Section_t section = {Coordinate(0, 0)};
+        section.net = _netlistIOPins;
+        section.beginSlot = 0;
+        section.endSlot = _slots.size();
+        _sections.clear();
+        _sections.push_back(section);
+
+        PerimeterAssignment perimeter(_slots);
+        std::vector<int> slotOfPin;
+        if (not perimeter.solve(_sections[0].net, slotOfPin)) {
+                std::cout << "ERROR: not enough free slots for "
+                          << _sections[0].net.numIOPins() << " I/O pins\n";
+                exit(1);
+        }
+
+        NetlistView& net = _sections[0].net;
+        net.forEachIOPin([&](unsigned idx, const IOPin& ioPin) {
+                _slots.setUsed(slotOfPin[idx], true);
+                net.setPos(idx, _slots.pos(slotOfPin[idx]));
+                _assignment.push_back(ioPin);
+                _assignment.back().setPos(net.getPos(idx));
+        });
+        std::cout << " > Successfully assigned I/O pins\n";
+}
+
+void IOPlacementKernel::assignZeroSinkIOs() {
+        // The pins take the first free slots, in order
+        std::vector<unsigned> slots;
+        _slots.reserve(0, _zeroSinkIOs.size(), slots);
+        for (unsigned i = 0; i < slots.size(); ++i) {
+                _zeroSinkIOs[i].setPos(_slots.pos(slots[i]));
+                _assignment.push_back(_zeroSinkIOs[i]);
+        }
+        _zeroSinkIOs.clear();
+}
+
 void IOPlacementKernel::printConfig() {
         std::cout << " * Num of slots          " << _slots.size() << "\n";
         std::cout << " * Num of I/O            " << _netlist.numIOPins() << "\n";
         std::cout << " * Num of I/O w/sink     " << _netlistIOPins.numIOPins() << "\n";
         std::cout << " * Num of I/O w/o sink   " << _zeroSinkIOs.size() << "\n";
+        std::cout << " * Num of blockages      " << _blockages.size() << "\n";
         std::cout << " * Slots Per Section     " << _slotsPerSection << "\n";
         std::cout << " * Slots Increase Factor " << _slotsIncreaseFactor << "\n";
         std::cout << " * Usage Per Section     " << _usagePerSection << "\n";
         std::cout << " * Usage Increase Factor " << _usageIncreaseFactor << "\n";
-        std::cout << " * Force Pin Spread      " << _forcePinSpread << "\n\n";
+        std::cout << " * Force Pin Spread      " << _forcePinSpread << "\n";
+        std::cout << " * Assignment Solver     " << _solverType << "\n";
+        std::cout << " * Candidates Per Pin    " << _numCandidates << "\n";
+        std::cout << " * Warm Start            " << _warmStart << "\n";
+        std::cout << " * Compact Costs         " << _compactCosts << "\n";
+        std::cout << " * Cluster Size          " << _clusterSize << "\n";
+        std::cout << " * Flow Sections         " << _flowSections << "\n";
+        std::cout << " * Refine Window         " << _refineWindow << "\n";
+        std::cout << " * Perimeter Solver      " << _perimeterSolver << "\n";
+        std::cout << " * Cost Kernel           " << CostKernel::isaName()
+                  << "\n\n";
+}
+
+// Bisections of the section usage, enough for a float in (0, 1]
+static const int USAGE_SEARCH_STEPS = 24;
+
+// Assignments of the pins to the sized sections before giving up
+static const unsigned MAX_SETUP_ATTEMPTS = 10;
+
+// Pins each section takes with the given usage: curSlots < maxSlots
+static unsigned sectionCapacity(const Section_t& section, float usage) {
+        float maxSlots = section.numSlots * usage;
+        return maxSlots > 0.0f ? (unsigned)std::ceil(maxSlots) : 0;
+}
+
+void IOPlacementKernel::computeSectionDemand(std::vector<unsigned>& demand) {
+        // Without pin spread, each pin only goes to its cheapest section
+        demand.assign(_sections.size(), 0);
+        if (_forcePinSpread || _flowSections > 0) {
+                return;
+        }
+        _sectionIndex.build(_sections);
+        for (unsigned idx = 0; idx < (unsigned)_netlistIOPins.numIOPins();
+             ++idx) {
+                _sectionIndex.begin(_netlistIOPins, idx);
+                demand[_sectionIndex.next()]++;
+        }
+}
+
+bool IOPlacementKernel::sectionsFit(float usage,
+                                    const std::vector<unsigned>& demand) {
+        if (_forcePinSpread || _flowSections > 0) {
+                // Pins spill over to any section with room left
+                unsigned capacity = 0;
+                for (const Section_t& section : _sections) {
+                        capacity += sectionCapacity(section, usage);
+                }
+                return capacity >= (unsigned)_netlistIOPins.numIOPins();
+        }
+        for (unsigned i = 0; i < _sections.size(); ++i) {
+                if (demand[i] > sectionCapacity(_sections[i], usage)) {
+                        return false;
+                }
+        }
+        return true;
+}
+
+bool IOPlacementKernel::assignPinsSectionsFlow() {
+        NetlistView& net = _netlistIOPins;
+        sectionVector_t& sections = _sections;
+        createSections();
+        _sectionIndex.build(sections);
+
+        const unsigned numPins = net.numIOPins();
+        std::vector<unsigned> capacities(sections.size());
+        for (unsigned i = 0; i < sections.size(); ++i) {
+                capacities[i] = sectionCapacity(sections[i], _usagePerSection);
+        }
+
+        // Pins may only go to their cheapest sections; as in the candidate
+        // slots mode, the candidates double until every pin fits
+        unsigned numCandidates = std::min<unsigned>(_flowSections,
+                                                    sections.size());
+        SparseCostMatrix matrix;
+        CapacitatedAssignmentSolver solver;
+        std::vector<int> sectionOf;
+        std::vector<unsigned> candidates;
+        std::vector<DBU> costs;
+        while (true) {
+                matrix.clear(numPins, sections.size());
+                for (unsigned idx = 0; idx < numPins; ++idx) {
+                        candidates.clear();
+                        costs.clear();
+                        _sectionIndex.begin(net, idx);
+                        for (int i = _sectionIndex.next();
+                             i >= 0 && candidates.size() < numCandidates;
+                             i = _sectionIndex.next()) {
+                                candidates.push_back(i);
+                                costs.push_back(net.computeIONetHPWL(
+                                    idx, sections[i].pos));
+                        }
+                        matrix.addPin(candidates, costs);
+                }
+                if (solver.solve(matrix, capacities, sectionOf)) {
+                        break;
+                }
+                if (numCandidates == sections.size()) {
+                        std::cout << " > Unsuccessfully assigned I/O pins\n";
+                        return false;
+                }
+                numCandidates = std::min<unsigned>(2 * numCandidates,
+                                                   sections.size());
+        }
+
+        net.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
+                Section_t& section = sections[sectionOf[idx]];
+                section.net.addIONet(net.netlistIdx(idx));
+                section.curSlots++;
+        });
+        std::cout << " > Successfully assigned I/O pins\n";
+        return true;
+}
+
+void IOPlacementKernel::sizeSections() {
+        // The smallest section size that fits the pins with full usage is
+        // found by binary search, then the smallest usage that fits them.
+        // Each step only needs the demand of the sections, not a full pass
+        // of assignPinsSections.
+        std::vector<unsigned> demand;
+        createSections();
+        computeSectionDemand(demand);
+        if (not sectionsFit(1.0f, demand)) {
+                // A single section with every slot fits if any size does
+                unsigned low = _slotsPerSection;
+                unsigned high = std::max(low, _slots.size()) + 1;
+                _slotsPerSection = high;
+                createSections();
+                computeSectionDemand(demand);
+                if (not sectionsFit(1.0f, demand)) {
+                        std::cout << "ERROR: number of pins ("
+                                  << _netlistIOPins.numIOPins()
+                                  << ") exceed the free slots\n";
+                        exit(1);
+                }
+                while (high - low > 1) {
+                        _slotsPerSection = low + (high - low) / 2;
+                        createSections();
+                        computeSectionDemand(demand);
+                        if (sectionsFit(1.0f, demand)) {
+                                high = _slotsPerSection;
+                        } else {
+                                low = _slotsPerSection;
+                        }
+                }
+                _slotsPerSection = high;
+                createSections();
+                computeSectionDemand(demand);
+        }
+
+        if (sectionsFit(_usagePerSection, demand)) {
+                return;
+        }
+        float low = _usagePerSection;
+        float high = 1.0f;
+        for (int step = 0; step < USAGE_SEARCH_STEPS; ++step) {
+                float mid = (low + high) / 2;
+                if (sectionsFit(mid, demand)) {
+                        high = mid;
+                } else {
+                        low = mid;
+                }
+        }
+        _usagePerSection = high;
 }
 
 void IOPlacementKernel::setupSections() {
@@ -432,14 +567,26 @@ void IOPlacementKernel::setupSections() {
                              "_usageIncreaseFactor or _slotsIncreaseFactor "
                              "must be != 0\n";
         }
+        sizeSections();
+        printConfig();
         do {
                 std::cout << "Tentative " << i++ << " to setup sections\n";
-                printConfig();
 
                 allAssigned = assignPinsSections();
 
-                _usagePerSection *= (1 + _usageIncreaseFactor);
-                _slotsPerSection *= (1 + _slotsIncreaseFactor);
+                // sizeSections only compares capacities with the demand, so
+                // the greedy assignment may still fail; retry a few times
+                if (not allAssigned) {
+                        if (i == MAX_SETUP_ATTEMPTS) {
+                                std::cout << "ERROR: could not assign the "
+                                          << "I/O pins to sections after "
+                                          << i << " attempts\n";
+                                exit(1);
+                        }
+                        _usagePerSection *= (1 + _usageIncreaseFactor);
+                        _slotsPerSection *= (1 + _slotsIncreaseFactor);
+                        printConfig();
+                }
                 if (_sections.size() > MAX_SECTIONS_RECOMMENDED) {
                         std::cout
                             << "WARNING: number of sections is "
@@ -448,7 +595,9 @@ void IOPlacementKernel::setupSections() {
                             << MAX_SECTIONS_RECOMMENDED
                             << " this may negatively affect performance\n";
                 }
-                if (_slotsPerSection > MAX_SLOTS_RECOMMENDED) {
+                // Sparse sections only keep a few candidates per pin
+                if (_slotsPerSection > MAX_SLOTS_RECOMMENDED &&
+                    _numCandidates == 0) {
                         std::cout
                             << "WARNING: number of slots per sections is "
                             << _slotsPerSection
@@ -459,6 +608,20 @@ void IOPlacementKernel::setupSections() {
         } while (not allAssigned);
 }
 
+void IOPlacementKernel::setupClusteredSections() {
+        PinClustering clustering(_core, _slots, _clusterSize);
+        if (clustering.numFreeSlots() < (unsigned)_netlistIOPins.numIOPins()) {
+                std::cout << "ERROR: number of pins ("
+                          << _netlistIOPins.numIOPins()
+                          << ") exceed the free slots ("
+                          << clustering.numFreeSlots() << ")\n";
+                exit(1);
+        }
+        clustering.createSections(_netlistIOPins, _sections);
+        std::cout << " > Multilevel mode created " << _sections.size()
+                  << " sections\n";
+}
+
 inline void IOPlacementKernel::updateOrientation(IOPin& pin) {
         const DBU x = pin.getX();
         const DBU y = pin.getY();
@@ -548,18 +711,24 @@ inline void IOPlacementKernel::updatePinArea(IOPin& pin) {
         }
 }
 
-DBU IOPlacementKernel::returnIONetsHPWL(Netlist& netlist) {
+DBU IOPlacementKernel::returnIONetsHPWL(NetlistView& netlist) {
         unsigned pinIndex = 0;
         DBU hpwl = 0;
         netlist.forEachIOPin([&](unsigned idx, IOPin& ioPin) {
-                hpwl += netlist.computeIONetHPWL(idx, ioPin.getPosition());
+                hpwl += netlist.computeIONetHPWL(idx, netlist.getPos(idx));
                 pinIndex++;
         });
 
         return hpwl;
 }
 
-DBU IOPlacementKernel::returnIONetsHPWL() { return returnIONetsHPWL(_netlist); }
+DBU IOPlacementKernel::returnIONetsHPWL() {
+        NetlistView netlist(_netlist);
+        for (int idx = 0; idx < _netlist.numIOPins(); ++idx) {
+                netlist.addIONet(idx);
+        }
+        return returnIONetsHPWL(netlist);
+}
 
 void IOPlacementKernel::run() {
         initParms();
@@ -596,41 +765,135 @@ void IOPlacementKernel::run() {
         }
 
         if (_reportHPWL) {
-                initHPWL = returnIONetsHPWL(_netlist);
+                initHPWL = returnIONetsHPWL();
         }
 
         if (not _cellsPlaced || (_randomMode > 0)) {
                 std::cout << "WARNING: running random pin placement\n";
                 randomPlacement(_randomMode);
+        } else if (_perimeterSolver) {
+                assignPinsPerimeter();
+                assignZeroSinkIOs();
         } else {
-                setupSections();
+                if (_clusterSize > 0) {
+                        setupClusteredSections();
+                } else {
+                        setupSections();
+                }
 
+                const WarmStart* warmStart = nullptr;
+                if (_warmStart) {
+                        if (_warmStartFile.size() != 0 &&
+                            not _warmStartData.read(_warmStartFile)) {
+                                std::cout << " * Warm start file not found, "
+                                          << "solving from scratch\n";
+                        }
+                        std::cout << " * Warm start with "
+                                  << _warmStartData.size() << " pins\n";
+                        warmStart = &_warmStartData;
+                }
+
+                hgVec.reserve(_sections.size());
                 for (unsigned idx = 0; idx < _sections.size(); idx++) {
                         if (_sections[idx].net.numIOPins() > 0) {
-                                HungarianMatching hg(_sections[idx], _slots);
-                                hgVec.push_back(hg);
+                                hgVec.emplace_back(_sections[idx], _slots,
+                                                   _solverType, _numCandidates,
+                                                   warmStart, _compactCosts);
                         }
                 }
 
-#pragma omp parallel for
+                // One workspace per thread, sized for the largest section
+                unsigned maxPins = 0;
+                unsigned maxSlots = 0;
                 for (unsigned idx = 0; idx < hgVec.size(); idx++) {
-                        hgVec[idx].run();
+                        maxPins = std::max(maxPins, hgVec[idx].numIOPins());
+                        maxSlots = std::max(maxSlots, hgVec[idx].numSlots());
+                }
+                std::vector<SolverWorkspace> workspaces(omp_get_max_threads());
+                for (unsigned i = 0; i < workspaces.size(); i++) {
+                        workspaces[i].init(_solverType, maxPins, maxSlots,
+                                           _numCandidates);
                 }
 
+                // Longest job first: sections are queued by decreasing
+                // predicted cost, so the largest ones do not start last
+                std::vector<unsigned> order(hgVec.size());
+                std::iota(order.begin(), order.end(), 0);
+                std::stable_sort(order.begin(), order.end(),
+                                 [&](unsigned a, unsigned b) {
+                                         return hgVec[a].predictedCost() >
+                                                hgVec[b].predictedCost();
+                                 });
+
+                if (_solverType == SOLVER_AUCTION) {
+                        // The auction solver bids in parallel inside each
+                        // section, so its sections are solved one at a time
+                        for (unsigned idx : order) {
+                                hgVec[idx].run(workspaces[0]);
+                        }
+                } else {
+                        // Each section is a task taken by the next idle
+                        // thread. A thread does not start another section
+                        // while its own waits for subtasks (tied tasks), so
+                        // its workspace is never shared.
+#pragma omp parallel
+#pragma omp single
+                        for (unsigned idx : order) {
+#pragma omp task firstprivate(idx)
+                                hgVec[idx].run(
+                                    workspaces[omp_get_thread_num()]);
+                        }
+                }
+
+                // Each section writes its pins to its own range
+                std::vector<unsigned> offsets(hgVec.size());
+                const unsigned firstAssigned = _assignment.size();
+                unsigned numAssigned = firstAssigned;
+                for (unsigned idx = 0; idx < hgVec.size(); idx++) {
+                        offsets[idx] = numAssigned;
+                        numAssigned += hgVec[idx].numAssigned();
+                }
+                _assignment.resize(numAssigned);
+#pragma omp parallel for
                 for (unsigned idx = 0; idx < hgVec.size(); idx++) {
-                        hgVec[idx].getFinalAssignment(_assignment);
+                        hgVec[idx].getFinalAssignment(_assignment,
+                                                      offsets[idx]);
                 }
 
-                unsigned i = 0;
-                while (_zeroSinkIOs.size() > 0 && i < _slots.size()) {
-                        if (not _slots[i].used && not _slots[i].blocked) {
-                                _slots[i].used = true;
-                                _zeroSinkIOs[0].setPos(_slots[i].pos);
-                                _assignment.push_back(_zeroSinkIOs[0]);
-                                _zeroSinkIOs.erase(_zeroSinkIOs.begin());
+                if (_warmStart) {
+                        // Kept in memory for the next run of the session.
+                        // Taken before the refinement: the prices belong to
+                        // the section matchings that the next run starts.
+                        _warmStartData.clear();
+                        for (unsigned idx = 0; idx < hgVec.size(); idx++) {
+                                hgVec[idx].getWarmStart(_warmStartData);
+                        }
+                        if (_warmStartFile.size() != 0 &&
+                            not _warmStartData.write(_warmStartFile)) {
+                                std::cout << "ERROR: could not write warm "
+                                          << "start file " << _warmStartFile
+                                          << "\n";
+                                exit(1);
                         }
-                        i++;
                 }
+
+                if (_refineWindow > 0) {
+                        std::vector<AssignedPin> pins(numAssigned -
+                                                      firstAssigned);
+#pragma omp parallel for
+                        for (unsigned idx = 0; idx < hgVec.size(); idx++) {
+                                hgVec[idx].getAssignedPins(
+                                    pins, offsets[idx] - firstAssigned);
+                        }
+                        BoundaryRefinement refinement(_slots, _sections,
+                                                      _refineWindow);
+                        DBU gain = refinement.run(pins, _assignment,
+                                                  firstAssigned);
+                        std::cout << " > Boundary refinement reduced HPWL by "
+                                  << gain << "\n";
+                }
+
+                assignZeroSinkIOs();
         }
 #pragma omp parallel for
         for (unsigned i = 0; i < _assignment.size(); ++i) {
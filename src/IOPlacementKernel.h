@@ -38,12 +38,22 @@
 #ifndef __IOPLACEMENTKERNEL_H_
 #define __IOPLACEMENTKERNEL_H_
 
+#include "AssignmentSolver.h"
+#include "Blockages.h"
+#include "BoundaryRefinement.h"
 #include "Core.h"
+#include "CostKernel.h"
 #include "HungarianMatching.h"
 #include "IOPlacement.h"
 #include "Netlist.h"
 #include "Parameters.h"
+#include "PerimeterAssignment.h"
+#include "Philox.h"
+#include "PinClustering.h"
+#include "SectionIndex.h"
 #include "Slots.h"
+#include "SparseAssignment.h"
+#include "WarmStart.h"
 #include "DBWrapper.h"
 
 enum RandomMode { None, Full, Even, Group };
@@ -65,15 +75,31 @@ class IOPlacementKernel {
         float _usageIncreaseFactor = 0.01f;
 
         bool _forcePinSpread = true;
+        SolverType _solverType = SOLVER_MUNKRES;
+        unsigned _numCandidates = 0;
+        bool _warmStart = false;
+        std::string _warmStartFile;
+        WarmStart _warmStartData;
+#ifdef IOPLACER_DBU32
+        // Within the checked die the costs of a row always fit 32 bits
+        bool _compactCosts = true;
+#else
+        bool _compactCosts = false;
+#endif
+        unsigned _clusterSize = 0;
+        unsigned _flowSections = 0;
+        unsigned _refineWindow = 0;
+        bool _perimeterSolver = false;
         std::string _blockagesFile;
-        std::vector<std::pair<Coordinate, Coordinate>> _blockagesArea;
+        Blockages _blockages;
 
        private:
         DBWrapper _dbWrapper;
         Parameters* _parms;
-        Netlist _netlistIOPins;
+        NetlistView _netlistIOPins;
         slotVector_t _slots;
         sectionVector_t _sections;
+        SectionIndex _sectionIndex;
         std::vector<IOPin> _zeroSinkIOs;
         RandomMode _randomMode = RandomMode::Full;
         bool _cellsPlaced = true;
@@ -85,12 +111,18 @@ class IOPlacementKernel {
         void defineSlots();
         void createSections();
         void setupSections();
+        void sizeSections();
+        void computeSectionDemand(std::vector<unsigned>& demand);
+        bool sectionsFit(float usage, const std::vector<unsigned>& demand);
+        void setupClusteredSections();
         bool assignPinsSections();
-        DBU returnIONetsHPWL(Netlist&);
+        bool assignPinsSectionsFlow();
+        void assignPinsPerimeter();
+        void assignZeroSinkIOs();
+        DBU returnIONetsHPWL(NetlistView&);
 
         inline void updateOrientation(IOPin&);
         inline void updatePinArea(IOPin&);
-        inline bool checkBlocked(DBU, DBU);
 
        public:
         IOPlacementKernel(Parameters&);
@@ -0,0 +1,404 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "LAPJV.h"
+
+#include <algorithm>
+#include <limits>
+
+static const DBU BIG = std::numeric_limits<DBU>::max() / 4;
+static const unsigned MAX_REDUCTION_STEPS = 8;
+
+template <typename Cost>
+void LAPJVSolver::init(Matrix<Cost>& matrix) {
+        const unsigned numPins = matrix.rows();
+        const unsigned numSlots = matrix.columns();
+
+        // Sections usually have more slots than pins, in which case the
+        // rectangular problem is solved as is, without dummy pins. Only the
+        // unexpected case of missing slots is padded with zero cost slots.
+        _numRows = numPins;
+        _numCols = std::max(numSlots, numPins);
+        if (_numCols > numSlots) {
+                matrix.resize(_numRows, _numCols, 0);
+        }
+
+        _v.assign(_numCols, 0);
+        _rowSol.assign(_numRows, -1);
+        _colSol.assign(_numCols, -1);
+        _free.assign(_numRows, 0);
+        _colList.assign(_numCols, 0);
+        _matches.assign(_numRows, 0);
+        _pred.assign(_numCols, 0);
+        _d.assign(_numCols, 0);
+}
+
+template <typename Cost>
+unsigned LAPJVSolver::columnReduction(const Matrix<Cost>& cost) {
+        // Reverse order gives better initial assignments
+        for (int j = _numCols - 1; j >= 0; --j) {
+                DBU min = cost(0, j);
+                unsigned imin = 0;
+                for (unsigned i = 1; i < _numRows; ++i) {
+                        if (cost(i, j) < min) {
+                                min = cost(i, j);
+                                imin = i;
+                        }
+                }
+                _v[j] = min;
+                if (++_matches[imin] == 1) {
+                        _rowSol[imin] = j;
+                        _colSol[j] = imin;
+                } else if (_v[j] < _v[_rowSol[imin]]) {
+                        int j1 = _rowSol[imin];
+                        _rowSol[imin] = j;
+                        _colSol[j] = imin;
+                        _colSol[j1] = -1;
+                } else {
+                        _colSol[j] = -1;
+                }
+        }
+
+        // Reduction transfer from rows assigned exactly once
+        unsigned numFree = 0;
+        for (unsigned i = 0; i < _numRows; ++i) {
+                if (_matches[i] == 0) {
+                        _free[numFree++] = i;
+                } else if (_matches[i] == 1) {
+                        int j1 = _rowSol[i];
+                        DBU min = BIG;
+                        for (unsigned j = 0; j < _numCols; ++j) {
+                                if ((int)j != j1) {
+                                        min = std::min(min, cost(i, j) - _v[j]);
+                                }
+                        }
+                        _v[j1] -= min;
+                }
+        }
+
+        return numFree;
+}
+
+void LAPJVSolver::reserve(unsigned numPins, unsigned numSlots) {
+        const unsigned numCols = std::max(numSlots, numPins);
+        _v.reserve(numCols);
+        _rowSol.reserve(numPins);
+        _colSol.reserve(numCols);
+        _free.reserve(numPins);
+        _colList.reserve(numCols);
+        _matches.reserve(numPins);
+        _pred.reserve(numCols);
+        _d.reserve(numCols);
+        _initSlots.reserve(numPins);
+        _initPrices.reserve(numCols);
+}
+
+void LAPJVSolver::setWarmStart(const std::vector<int>& slots,
+                               const std::vector<DBU>& prices) {
+        _initSlots = slots;
+        _initPrices = prices;
+}
+
+bool LAPJVSolver::getSlotPrices(std::vector<DBU>& prices) const {
+        prices.assign(_v.begin(), _v.end());
+        return true;
+}
+
+template <typename Cost>
+unsigned LAPJVSolver::warmStart(const Matrix<Cost>& cost) {
+        // Prices must stay non-positive and free columns must have price
+        // zero, otherwise the rectangular solution would not be optimal
+        for (unsigned j = 0; j < _numCols; ++j) {
+                DBU price = j < _initPrices.size() ? _initPrices[j] : 0;
+                _v[j] = std::min<DBU>(price, 0);
+        }
+        for (unsigned i = 0; i < _numRows && i < _initSlots.size(); ++i) {
+                int j = _initSlots[i];
+                if (j >= 0 && j < (int)_numCols && _colSol[j] < 0) {
+                        _rowSol[i] = j;
+                        _colSol[j] = i;
+                }
+        }
+        for (unsigned j = 0; j < _numCols; ++j) {
+                if (_colSol[j] < 0) {
+                        _v[j] = 0;
+                }
+        }
+
+        // Keep only the rows whose column still has the minimum reduced
+        // cost. Freeing a column resets its price, which may in turn
+        // release other rows, so repeat until nothing changes.
+        const int numRows = _numRows;
+        bool changed = true;
+        while (changed) {
+                changed = false;
+                // Serial: solves already run one per thread
+                for (int i = 0; i < numRows; ++i) {
+                        int j1 = _rowSol[i];
+                        if (j1 < 0) {
+                                continue;
+                        }
+                        const Cost* row = cost.row(i);
+                        DBU h = row[j1] - _v[j1];
+                        for (unsigned j = 0; j < _numCols; ++j) {
+                                if (row[j] - _v[j] < h) {
+                                        _matches[i] = 1;
+                                        break;
+                                }
+                        }
+                }
+                for (unsigned i = 0; i < _numRows; ++i) {
+                        if (_matches[i] == 1) {
+                                _matches[i] = 0;
+                                _colSol[_rowSol[i]] = -1;
+                                _v[_rowSol[i]] = 0;
+                                _rowSol[i] = -1;
+                                changed = true;
+                        }
+                }
+        }
+
+        unsigned numFree = 0;
+        for (unsigned i = 0; i < _numRows; ++i) {
+                if (_rowSol[i] < 0) {
+                        _free[numFree++] = i;
+                }
+        }
+        _initSlots.clear();
+        _initPrices.clear();
+        return numFree;
+}
+
+template <typename Cost>
+unsigned LAPJVSolver::augmentingRowReduction(const Matrix<Cost>& cost,
+                                             unsigned numFree) {
+        for (int loop = 0; loop < 2; ++loop) {
+                unsigned k = 0;
+                unsigned prevNumFree = numFree;
+                unsigned steps = 0;
+                numFree = 0;
+                while (k < prevNumFree) {
+                        if (++steps > MAX_REDUCTION_STEPS * prevNumFree) {
+                                // Rows competing for the same few columns
+                                // may bid against each other for a long
+                                // time. Leave them to the augmentation phase.
+                                while (k < prevNumFree) {
+                                        _free[numFree++] = _free[k++];
+                                }
+                                break;
+                        }
+                        unsigned i = _free[k++];
+
+                        // Find minimum and second minimum reduced cost
+                        const Cost* row = cost.row(i);
+                        DBU umin = row[0] - _v[0];
+                        DBU usubmin = BIG;
+                        int j1 = 0;
+                        int j2 = 0;
+                        for (unsigned j = 1; j < _numCols; ++j) {
+                                DBU h = row[j] - _v[j];
+                                if (h < usubmin) {
+                                        if (h >= umin) {
+                                                usubmin = h;
+                                                j2 = j;
+                                        } else {
+                                                usubmin = umin;
+                                                umin = h;
+                                                j2 = j1;
+                                                j1 = j;
+                                        }
+                                }
+                        }
+
+                        int i0 = _colSol[j1];
+                        if (umin < usubmin) {
+                                // Change the reduction of the minimum column
+                                // to increase the minimum reduced cost in the
+                                // row to the second minimum
+                                _v[j1] -= usubmin - umin;
+                        } else if (i0 > -1) {
+                                // Minimum and second minimum are equal and the
+                                // minimum column is assigned: swap columns
+                                j1 = j2;
+                                i0 = _colSol[j2];
+                        }
+
+                        _rowSol[i] = j1;
+                        _colSol[j1] = i;
+
+                        if (i0 > -1) {
+                                _rowSol[i0] = -1;
+                                if (umin < usubmin) {
+                                        // Put the previously assigned row at
+                                        // the front of the list to be
+                                        // processed right away
+                                        _free[--k] = i0;
+                                } else {
+                                        _free[numFree++] = i0;
+                                }
+                        }
+                }
+        }
+
+        return numFree;
+}
+
+template <typename Cost>
+void LAPJVSolver::augment(const Matrix<Cost>& cost, unsigned freeRow) {
+        // Dijkstra shortest path from the free row to an unassigned column
+        const Cost* freeCost = cost.row(freeRow);
+        for (unsigned j = 0; j < _numCols; ++j) {
+                _d[j] = freeCost[j] - _v[j];
+                _pred[j] = freeRow;
+                _colList[j] = j;
+        }
+
+        unsigned low = 0;
+        unsigned up = 0;
+        int last = 0;
+        int endOfPath = -1;
+        DBU min = 0;
+        bool unassignedFound = false;
+        do {
+                if (up == low) {
+                        // Collect the columns with the new minimum distance
+                        last = (int)low - 1;
+                        min = _d[_colList[up++]];
+                        for (unsigned k = up; k < _numCols; ++k) {
+                                int j = _colList[k];
+                                DBU h = _d[j];
+                                if (h <= min) {
+                                        if (h < min) {
+                                                up = low;
+                                                min = h;
+                                        }
+                                        _colList[k] = _colList[up];
+                                        _colList[up++] = j;
+                                }
+                        }
+                        for (unsigned k = low; k < up; ++k) {
+                                if (_colSol[_colList[k]] < 0) {
+                                        endOfPath = _colList[k];
+                                        unassignedFound = true;
+                                        break;
+                                }
+                        }
+                }
+
+                if (!unassignedFound) {
+                        // Scan a column of the minimum set
+                        int j1 = _colList[low++];
+                        int i = _colSol[j1];
+                        const Cost* row = cost.row(i);
+                        DBU h = row[j1] - _v[j1] - min;
+                        for (unsigned k = up; k < _numCols; ++k) {
+                                int j = _colList[k];
+                                DBU v2 = row[j] - _v[j] - h;
+                                if (v2 < _d[j]) {
+                                        _pred[j] = i;
+                                        if (v2 == min) {
+                                                if (_colSol[j] < 0) {
+                                                        endOfPath = j;
+                                                        unassignedFound = true;
+                                                        break;
+                                                }
+                                                _colList[k] = _colList[up];
+                                                _colList[up++] = j;
+                                        }
+                                        _d[j] = v2;
+                                }
+                        }
+                }
+        } while (!unassignedFound);
+
+        // Update the prices of the scanned columns
+        for (int k = 0; k <= last; ++k) {
+                int j1 = _colList[k];
+                _v[j1] += _d[j1] - min;
+        }
+
+        // Augment along the alternating path
+        int i;
+        do {
+                i = _pred[endOfPath];
+                _colSol[endOfPath] = i;
+                int j1 = endOfPath;
+                endOfPath = _rowSol[i];
+                _rowSol[i] = j1;
+        } while (i != (int)freeRow);
+}
+
+template <typename Cost>
+void LAPJVSolver::run(Matrix<Cost>& matrix, std::vector<int>& assignment) {
+        const unsigned numSlots = matrix.columns();
+        init(matrix);
+
+        unsigned numFree = 0;
+        if (not _initSlots.empty()) {
+                numFree = warmStart(matrix);
+        } else if (_numRows == _numCols) {
+                numFree = columnReduction(matrix);
+        } else {
+                // Column reduction needs a square matrix. With all prices at
+                // zero, the slots that are never assigned keep a zero price
+                // and the prices stay optimal for the rectangular problem.
+                for (unsigned i = 0; i < _numRows; ++i) {
+                        _free[numFree++] = i;
+                }
+        }
+        numFree = augmentingRowReduction(matrix, numFree);
+        for (unsigned f = 0; f < numFree; ++f) {
+                augment(matrix, _free[f]);
+        }
+
+        // Pins matched to padding slots are left without a slot
+        assignment.assign(_rowSol.begin(), _rowSol.end());
+        for (int& slot : assignment) {
+                if (slot >= (int)numSlots) {
+                        slot = -1;
+                }
+        }
+}
+
+void LAPJVSolver::solve(Matrix<DBU>& matrix, std::vector<int>& assignment) {
+        run(matrix, assignment);
+}
+
+void LAPJVSolver::solve(Matrix<CompactCost>& matrix,
+                        std::vector<int>& assignment) {
+        run(matrix, assignment);
+}
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __LAPJV_H_
+#define __LAPJV_H_
+
+#include <vector>
+
+#include "AssignmentSolver.h"
+
+// Jonker-Volgenant shortest augmenting path solver. The pins (rows of the cost
+// matrix) are the rows of the assignment problem and the costs are read in
+// place, so every scan walks contiguous memory. Rectangular problems (more
+// slots than pins) are solved natively: each pin chooses among all slots and
+// the slots left over are simply never assigned.
+// A warm start keeps the pins whose previous slot is still optimal under the
+// previous prices, so only the pins that moved need to be augmented.
+class LAPJVSolver : public AssignmentSolver {
+       private:
+        unsigned _numRows;
+        unsigned _numCols;
+        std::vector<DBU> _v;
+        std::vector<int> _rowSol;
+        std::vector<int> _colSol;
+        std::vector<int> _free;
+        std::vector<int> _colList;
+        std::vector<int> _matches;
+        std::vector<int> _pred;
+        std::vector<DBU> _d;
+        std::vector<int> _initSlots;
+        std::vector<DBU> _initPrices;
+
+        template <typename Cost>
+        void run(Matrix<Cost>&, std::vector<int>&);
+        template <typename Cost>
+        void init(Matrix<Cost>&);
+        template <typename Cost>
+        unsigned columnReduction(const Matrix<Cost>&);
+        template <typename Cost>
+        unsigned warmStart(const Matrix<Cost>&);
+        template <typename Cost>
+        unsigned augmentingRowReduction(const Matrix<Cost>&, unsigned);
+        template <typename Cost>
+        void augment(const Matrix<Cost>&, unsigned);
+
+       public:
+        void solve(Matrix<DBU>&, std::vector<int>&) override;
+        void solve(Matrix<CompactCost>&, std::vector<int>&) override;
+        void reserve(unsigned numPins, unsigned numSlots) override;
+        void setWarmStart(const std::vector<int>&,
+                          const std::vector<DBU>&) override;
+        bool getSlotPrices(std::vector<DBU>&) const override;
+};
+
+#endif /* __LAPJV_H_ */
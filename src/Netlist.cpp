@@ -37,70 +37,55 @@
 
 #include "Netlist.h"
 
+#include <algorithm>
+#include <cstdlib>
+
 Netlist::Netlist() { _netPointer.push_back(0); }
 
 void Netlist::addIONet(const IOPin& ioPin,
                        const std::vector<InstancePin>& instPins) {
         _ioPins.push_back(ioPin);
-        _instPins.insert(_instPins.end(), instPins.begin(), instPins.end());
-        _netPointer.push_back(_instPins.size());
-}
-
-void Netlist::forEachIOPin(std::function<void(unsigned idx, IOPin&)> func) {
-        for (unsigned idx = 0; idx < _ioPins.size(); ++idx) {
-                func(idx, _ioPins[idx]);
+        for (const InstancePin& instPin : instPins) {
+                _sinkX.push_back(instPin.getX());
+                _sinkY.push_back(instPin.getY());
+                _sinkNames.push_back(instPin.getName());
         }
+        _netPointer.push_back(_sinkX.size());
+        _sinksBB.push_back(computeSinksBB(_ioPins.size() - 1));
 }
 
-void Netlist::forEachIOPin(
-    std::function<void(unsigned idx, const IOPin&)> func) const {
-        for (unsigned idx = 0; idx < _ioPins.size(); ++idx) {
-                func(idx, _ioPins[idx]);
-        }
-}
+Box Netlist::computeSinksBB(unsigned idx) const {
+        const Span<CoordDBU> sinksX = getSinksX(idx);
+        const Span<CoordDBU> sinksY = getSinksY(idx);
 
-void Netlist::forEachSinkOfIO(unsigned idx,
-                              std::function<void(InstancePin&)> func) {
-        unsigned netStart = _netPointer[idx];
-        unsigned netEnd = _netPointer[idx + 1];
-        for (unsigned idx = netStart; idx < netEnd; ++idx) {
-                func(_instPins[idx]);
-        }
-}
+        // Limits of the storage width, so that the box of a net without
+        // sinks stays inverted once stored in a Coordinate
+        DBU minX = std::numeric_limits<CoordDBU>::max();
+        DBU minY = std::numeric_limits<CoordDBU>::max();
+        DBU maxX = std::numeric_limits<CoordDBU>::min();
+        DBU maxY = std::numeric_limits<CoordDBU>::min();
 
-void Netlist::forEachSinkOfIO(
-    unsigned idx, std::function<void(const InstancePin&)> func) const {
-        unsigned netStart = _netPointer[idx];
-        unsigned netEnd = _netPointer[idx + 1];
-        for (unsigned idx = netStart; idx < netEnd; ++idx) {
-                func(_instPins[idx]);
+        for (DBU x : sinksX) {
+                minX = std::min(minX, x);
+                maxX = std::max(maxX, x);
+        }
+        for (DBU y : sinksY) {
+                minY = std::min(minY, y);
+                maxY = std::max(maxY, y);
         }
-}
 
-unsigned Netlist::numSinksOfIO(unsigned idx) {
-        unsigned netStart = _netPointer[idx];
-        unsigned netEnd = _netPointer[idx + 1];
-        return netEnd - netStart;
+        return Box(Coordinate(minX, minY), Coordinate(maxX, maxY));
 }
 
-int Netlist::numIOPins() { return _ioPins.size(); }
-
 Box Netlist::getBB(unsigned idx, Coordinate slotPos) {
-        unsigned netStart = _netPointer[idx];
-        unsigned netEnd = _netPointer[idx + 1];
-
-        DBU minX = slotPos.getX();
-        DBU minY = slotPos.getY();
-        DBU maxX = slotPos.getX();
-        DBU maxY = slotPos.getY();
-
-        for (unsigned idx = netStart; idx < netEnd; ++idx) {
-                Coordinate pos = _instPins[idx].getPos();
-                minX = std::min(minX, pos.getX());
-                maxX = std::max(maxX, pos.getX());
-                minY = std::min(minY, pos.getY());
-                maxY = std::max(maxY, pos.getY());
-        }
+        const Box& sinksBB = _sinksBB[idx];
+        Coordinate lower = sinksBB.getLowerBound();
+        Coordinate upper = sinksBB.getUpperBound();
+
+        DBU minX = std::min(lower.getX(), slotPos.getX());
+        DBU minY = std::min(lower.getY(), slotPos.getY());
+        DBU maxX = std::max(upper.getX(), slotPos.getX());
+        DBU maxY = std::max(upper.getY(), slotPos.getY());
 
         Coordinate upperBounds = Coordinate(maxX, maxY);
         Coordinate lowerBounds = Coordinate(minX, minY);
@@ -110,41 +95,21 @@ Box Netlist::getBB(unsigned idx, Coordinate slotPos) {
 }
 
 DBU Netlist::computeIONetHPWL(unsigned idx, Coordinate slotPos) {
-        unsigned netStart = _netPointer[idx];
-        unsigned netEnd = _netPointer[idx + 1];
-
-        DBU minX = slotPos.getX();
-        DBU minY = slotPos.getY();
-        DBU maxX = slotPos.getX();
-        DBU maxY = slotPos.getY();
-
-        for (unsigned idx = netStart; idx < netEnd; ++idx) {
-                Coordinate pos = _instPins[idx].getPos();
-                minX = std::min(minX, pos.getX());
-                maxX = std::max(maxX, pos.getX());
-                minY = std::min(minY, pos.getY());
-                maxY = std::max(maxY, pos.getY());
-        }
-
-        Coordinate upperBounds = Coordinate(maxX, maxY);
-        Coordinate lowerBounds = Coordinate(minX, minY);
-
-        Box netBBox(lowerBounds, upperBounds);
-
-        return netBBox.getHalfPerimeter();
+        return getBB(idx, slotPos).getHalfPerimeter();
 }
 
 DBU Netlist::computeDstIOtoPins(unsigned idx, Coordinate slotPos) {
-        unsigned netStart = _netPointer[idx];
-        unsigned netEnd = _netPointer[idx + 1];
+        const Span<CoordDBU> sinksX = getSinksX(idx);
+        const Span<CoordDBU> sinksY = getSinksY(idx);
+        const DBU slotX = slotPos.getX();
+        const DBU slotY = slotPos.getY();
 
         DBU totalDistance = 0;
 
-#pragma omp parallel for reduction(+ : totalDistance)
-        for (unsigned idx = netStart; idx < netEnd; ++idx) {
-                Coordinate pinPos = _instPins[idx].getPos();
-                totalDistance += abs(pinPos.getX() - slotPos.getX()) +
-                                 abs(pinPos.getY() - slotPos.getY());
+        // Serial: this is called from loops that are already parallel
+        for (unsigned k = 0; k < sinksX.size(); ++k) {
+                totalDistance += std::abs(sinksX[k] - slotX) +
+                                 std::abs(sinksY[k] - slotY);
         }
 
         return totalDistance;
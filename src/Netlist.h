@@ -40,25 +40,27 @@
 
 #include <string>
 #include <vector>
-#include <functional>
 #include <limits>
 #include <iostream>
 
 #include "Coordinate.h"
 #include "Box.h"
+#include "NameTable.h"
 
 enum Orientation { ORIENT_NORTH, ORIENT_SOUTH, ORIENT_EAST, ORIENT_WEST };
 enum Direction { DIR_IN, DIR_OUT, DIR_INOUT };
 
+// Names are ids in the NameTable of the netlist the pin belongs to
 class InstancePin {
        protected:
-        std::string _name;
+        NameId _name;
         Coordinate _pos;
 
        public:
-        InstancePin(const std::string& name, const Coordinate& pos)
+        InstancePin() : _name(NameTable::INVALID), _pos(0, 0) {}
+        InstancePin(NameId name, const Coordinate& pos)
             : _name(name), _pos(pos) {}
-        std::string getName() const { return _name; }
+        NameId getName() const { return _name; }
         Coordinate getPos() const { return _pos; }
         DBU getX() const { return _pos.getX(); }
         DBU getY() const { return _pos.getY(); }
@@ -70,13 +72,21 @@ class IOPin : public InstancePin {
         Direction _direction;
         Coordinate _lowerBound;
         Coordinate _upperBound;
-        std::string _netName;
-        std::string _locationType;
+        NameId _netName;
+        NameId _locationType;
 
        public:
-        IOPin(const std::string& name, const Coordinate& pos, Direction dir,
-              Coordinate lowerBound, Coordinate upperBound, std::string netName,
-              std::string locationType)
+        // Empty pin, overwritten when assignment lists are preallocated
+        IOPin()
+            : _orientation(ORIENT_NORTH),
+              _direction(DIR_INOUT),
+              _lowerBound(0, 0),
+              _upperBound(0, 0),
+              _netName(NameTable::INVALID),
+              _locationType(NameTable::INVALID) {}
+        IOPin(NameId name, const Coordinate& pos, Direction dir,
+              Coordinate lowerBound, Coordinate upperBound, NameId netName,
+              NameId locationType)
             : InstancePin(name, pos),
               _orientation(ORIENT_NORTH),
               _direction(dir),
@@ -97,32 +107,153 @@ class IOPin : public InstancePin {
         Direction getDirection() const { return _direction; }
         Coordinate getLowerBound() const { return _lowerBound; };
         Coordinate getUpperBound() const { return _upperBound; };
-        std::string getNetName() const { return _netName; }
-        std::string getLocationType() const { return _locationType; };
+        NameId getNetName() const { return _netName; }
+        NameId getLocationType() const { return _locationType; };
+};
+
+// Read-only view of a contiguous range of an array
+template <typename T>
+class Span {
+       private:
+        const T* _begin;
+        const T* _end;
+
+       public:
+        Span(const T* begin, const T* end) : _begin(begin), _end(end) {}
+        const T* begin() const { return _begin; }
+        const T* end() const { return _end; }
+        unsigned size() const { return _end - _begin; }
+        const T& operator[](unsigned i) const { return _begin[i]; }
 };
 
 class Netlist {
        private:
-        std::vector<InstancePin> _instPins;
+        // Sinks of all nets in structure-of-arrays form; the sinks of net
+        // idx are [_netPointer[idx], _netPointer[idx + 1])
+        std::vector<CoordDBU> _sinkX;
+        std::vector<CoordDBU> _sinkY;
+        std::vector<NameId> _sinkNames;
         std::vector<unsigned> _netPointer;
         std::vector<IOPin> _ioPins;
+        // Bounding box of the sinks of each net, computed when the net is
+        // added. Nets without sinks have an inverted box, so extending it
+        // by a point gives that point.
+        std::vector<Box> _sinksBB;
+        NameTable _names;
+
+        Box computeSinksBB(unsigned) const;
 
        public:
         Netlist();
 
         void addIONet(const IOPin&, const std::vector<InstancePin>&);
 
-        void forEachIOPin(std::function<void(unsigned, IOPin&)>);
-        void forEachIOPin(std::function<void(unsigned, const IOPin&)>) const;
-        void forEachSinkOfIO(unsigned, std::function<void(InstancePin&)>);
-        void forEachSinkOfIO(unsigned,
-                             std::function<void(const InstancePin&)>) const;
-        unsigned numSinksOfIO(unsigned);
-        int numIOPins();
+        // Pins refer to names by id; resolve them only for output
+        NameId intern(const std::string& name) { return _names.intern(name); }
+        const std::string& getName(NameId id) const {
+                return _names.getName(id);
+        }
+        const NameTable& getNameTable() const { return _names; }
+
+        // The visitors are templates, so the callbacks are inlined
+        template <typename Func>
+        void forEachIOPin(Func func) {
+                for (unsigned idx = 0; idx < _ioPins.size(); ++idx) {
+                        func(idx, _ioPins[idx]);
+                }
+        }
+        template <typename Func>
+        void forEachIOPin(Func func) const {
+                for (unsigned idx = 0; idx < _ioPins.size(); ++idx) {
+                        func(idx, _ioPins[idx]);
+                }
+        }
+        // Each sink of net idx as an InstancePin; loops that only need
+        // the positions should read getSinksX/getSinksY instead
+        template <typename Func>
+        void forEachSinkOfIO(unsigned idx, Func func) const {
+                for (unsigned k = _netPointer[idx]; k < _netPointer[idx + 1];
+                     ++k) {
+                        func(InstancePin(_sinkNames[k],
+                                         Coordinate(_sinkX[k], _sinkY[k])));
+                }
+        }
+        Span<CoordDBU> getSinksX(unsigned idx) const {
+                return Span<CoordDBU>(_sinkX.data() + _netPointer[idx],
+                                      _sinkX.data() + _netPointer[idx + 1]);
+        }
+        Span<CoordDBU> getSinksY(unsigned idx) const {
+                return Span<CoordDBU>(_sinkY.data() + _netPointer[idx],
+                                      _sinkY.data() + _netPointer[idx + 1]);
+        }
+        unsigned numSinksOfIO(unsigned idx) const {
+                return _netPointer[idx + 1] - _netPointer[idx];
+        }
+        int numIOPins() const { return _ioPins.size(); }
+        const IOPin& getIOPin(unsigned idx) const { return _ioPins[idx]; }
+        IOPin& getIOPin(unsigned idx) { return _ioPins[idx]; }
 
         DBU computeIONetHPWL(unsigned, Coordinate);
         DBU computeDstIOtoPins(unsigned, Coordinate);
         Box getBB(unsigned, Coordinate);
+        const Box& getSinksBB(unsigned idx) const { return _sinksBB[idx]; }
+};
+
+// Subset of the IO pins of a netlist, stored as their indexes in it. Pin
+// idx of the view is pin netlistIdx(idx) of the netlist, so sections and
+// filtered lists share the pins and sinks of one netlist. Placed positions
+// are kept in the view; the netlist keeps the input positions.
+class NetlistView {
+       private:
+        Netlist* _netlist = nullptr;
+        std::vector<unsigned> _netlistIdx;
+        std::vector<Coordinate> _pos;
+
+       public:
+        NetlistView() = default;
+        explicit NetlistView(Netlist& netlist) : _netlist(&netlist) {}
+
+        Netlist& getNetlist() const { return *_netlist; }
+        const std::string& getName(NameId id) const {
+                return _netlist->getName(id);
+        }
+        // Adds pin idx of the netlist, at its input position
+        void addIONet(unsigned idx) {
+                _netlistIdx.push_back(idx);
+                _pos.push_back(_netlist->getIOPin(idx).getPosition());
+        }
+        unsigned netlistIdx(unsigned idx) const { return _netlistIdx[idx]; }
+
+        template <typename Func>
+        void forEachIOPin(Func func) {
+                for (unsigned idx = 0; idx < _netlistIdx.size(); ++idx) {
+                        func(idx, _netlist->getIOPin(_netlistIdx[idx]));
+                }
+        }
+        template <typename Func>
+        void forEachIOPin(Func func) const {
+                const Netlist& netlist = *_netlist;
+                for (unsigned idx = 0; idx < _netlistIdx.size(); ++idx) {
+                        func(idx, netlist.getIOPin(_netlistIdx[idx]));
+                }
+        }
+        int numIOPins() const { return _netlistIdx.size(); }
+        const IOPin& getIOPin(unsigned idx) const {
+                return static_cast<const Netlist*>(_netlist)->getIOPin(
+                    _netlistIdx[idx]);
+        }
+        IOPin& getIOPin(unsigned idx) {
+                return _netlist->getIOPin(_netlistIdx[idx]);
+        }
+        Coordinate getPos(unsigned idx) const { return _pos[idx]; }
+        void setPos(unsigned idx, Coordinate pos) { _pos[idx] = pos; }
+
+        DBU computeIONetHPWL(unsigned idx, Coordinate slotPos) const {
+                return _netlist->computeIONetHPWL(_netlistIdx[idx], slotPos);
+        }
+        const Box& getSinksBB(unsigned idx) const {
+                return _netlist->getSinksBB(_netlistIdx[idx]);
+        }
 };
 
 #endif /* __NETLIST_H_ */
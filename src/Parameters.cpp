@@ -64,6 +64,14 @@ Parameters::Parameters(int argc, char** argv) {
                 ("_length-vertical,q"   , po::value<float>()           , "Length of the vertical pins in microns (optional)")
                 ("num-threads,t"        , po::value<int>()             , "Number of threads (optional)")
                 ("rand-seed,i"          , po::value<int>()             , "Seed for the random number generator engine (optional)")
+                ("solver,a"             , po::value<int>()             , "Assignment solver: 0 Munkres, 1 LAPJV, 2 Auction (int/enum) (optional)")
+                ("candidates,k"         , po::value<int>()             , "Number of candidate slots kept per pin, 0 for all (int) (optional)")
+                ("warm-start,g"         , po::value<std::string>()     , "File with the matching of the previous run, read if present and rewritten at the end (optional)")
+                ("compact-costs,p"      , po::value<int>()             , "Store the costs of each section in 32 bits (bool) (optional)")
+                ("cluster-size,y"       , po::value<int>()             , "Multilevel mode: pins per cluster, 0 disables (int) (optional)")
+                ("flow-sections,j"      , po::value<int>()             , "Assign pins to sections by min-cost flow over the N cheapest sections of each pin, 0 disables (int) (optional)")
+                ("refine-window,u"      , po::value<int>()             , "Slots on each side of a section boundary solved again after the sections, 0 disables (int) (optional)")
+                ("perimeter-solver,z"   , po::value<int>()             , "Assign all pins at once over the whole perimeter, without sections (bool) (optional)")
                 ;
         // clang-format on
 
@@ -139,6 +147,30 @@ Parameters::Parameters(int argc, char** argv) {
                 if (vm.count("rand-seed")) {
                         _randSeed = vm["rand-seed"].as<int>();
                 }
+                if (vm.count("solver")) {
+                        _assignmentSolver = vm["solver"].as<int>();
+                }
+                if (vm.count("candidates")) {
+                        _numCandidates = vm["candidates"].as<int>();
+                }
+                if (vm.count("warm-start")) {
+                        _warmStartFile = vm["warm-start"].as<std::string>();
+                }
+                if (vm.count("compact-costs")) {
+                        _compactCosts = vm["compact-costs"].as<int>();
+                }
+                if (vm.count("cluster-size")) {
+                        _clusterSize = vm["cluster-size"].as<int>();
+                }
+                if (vm.count("flow-sections")) {
+                        _flowSections = vm["flow-sections"].as<int>();
+                }
+                if (vm.count("refine-window")) {
+                        _refineWindow = vm["refine-window"].as<int>();
+                }
+                if (vm.count("perimeter-solver")) {
+                        _perimeterSolver = vm["perimeter-solver"].as<int>();
+                }
         } catch (const po::error& ex) {
                 std::cerr << ex.what() << '\n';
         }
@@ -176,6 +208,15 @@ void Parameters::printAll() const {
         std::cout << "Interactive mode: " << _interactiveMode << "\n";
         std::cout << "Num threads: " << _numThreads << "\n";
         std::cout << "Rand seed: " << _randSeed << "\n";
+        std::cout << "Assignment solver: " << _assignmentSolver << "\n";
+        std::cout << "Candidates per pin: " << _numCandidates << "\n";
+        std::cout << "Warm start: " << _warmStart << "\n";
+        std::cout << "Warm start file: " << _warmStartFile << "\n";
+        std::cout << "Compact costs: " << _compactCosts << "\n";
+        std::cout << "Cluster size: " << _clusterSize << "\n";
+        std::cout << "Flow sections: " << _flowSections << "\n";
+        std::cout << "Refine window: " << _refineWindow << "\n";
+        std::cout << "Perimeter solver: " << _perimeterSolver << "\n";
 
         std::cout << "\n";
         // clang-format on
@@ -63,6 +63,15 @@ class Parameters {
         bool  _interactiveMode = false;
         int _numThreads = -1;
         double _randSeed = 42.0;
+        int _assignmentSolver = -1;
+        int _numCandidates = -1;
+        bool _warmStart = false;
+        std::string _warmStartFile;
+        bool _compactCosts = false;
+        int _clusterSize = -1;
+        int _flowSections = -1;
+        int _refineWindow = -1;
+        bool _perimeterSolver = false;
 
        public:
         Parameters() = default;
@@ -103,6 +112,24 @@ class Parameters {
         int  getNumThreads() const { return _numThreads; }
         void setRandSeed(double seed) { _randSeed = seed; }
         double getRandSeed() const { return _randSeed; }
+        void setAssignmentSolver(int solver) { _assignmentSolver = solver; }
+        int getAssignmentSolver() const { return _assignmentSolver; }
+        void setNumCandidates(int candidates) { _numCandidates = candidates; }
+        int getNumCandidates() const { return _numCandidates; }
+        void setWarmStart(bool enable) { _warmStart = enable; }
+        bool getWarmStart() const { return _warmStart; }
+        void setWarmStartFile(const std::string& file) { _warmStartFile = file; }
+        const std::string& getWarmStartFile() const { return _warmStartFile; }
+        void setCompactCosts(bool enable) { _compactCosts = enable; }
+        bool getCompactCosts() const { return _compactCosts; }
+        void setClusterSize(int size) { _clusterSize = size; }
+        int getClusterSize() const { return _clusterSize; }
+        void setFlowSections(int num) { _flowSections = num; }
+        int getFlowSections() const { return _flowSections; }
+        void setRefineWindow(int window) { _refineWindow = window; }
+        int getRefineWindow() const { return _refineWindow; }
+        void setPerimeterSolver(bool enable) { _perimeterSolver = enable; }
+        bool getPerimeterSolver() const { return _perimeterSolver; }
 
         void printAll() const;
 };
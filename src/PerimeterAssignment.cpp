@@ -0,0 +1,415 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "PerimeterAssignment.h"
+
+#include <algorithm>
+#include <limits>
+
+static const DBU INF = std::numeric_limits<DBU>::max() / 4;
+
+void PerimeterAssignment::EnvelopeTree::init(unsigned size) {
+        _size = 1;
+        _levels = 0;
+        while (_size < size) {
+                _size *= 2;
+                ++_levels;
+        }
+        _nodes.assign(2 * _size, {INF, 0, INF, 0, INF, 0, false});
+        for (unsigned pos = 0; pos < _size; ++pos) {
+                _nodes[_size + pos].posW = pos;
+                _nodes[_size + pos].pos = pos;
+        }
+        for (unsigned node = _size - 1; node > 0; --node) {
+                pull(node);
+        }
+}
+
+void PerimeterAssignment::EnvelopeTree::applyMin(unsigned node, DBU offset,
+                                                 unsigned pin) {
+        Node& n = _nodes[node];
+        if (offset < n.offset) {
+                n.offset = offset;
+                n.pin = pin;
+        }
+        if (n.minW < INF && offset + n.minW < n.minValue) {
+                n.minValue = offset + n.minW;
+                n.pos = n.posW;
+        }
+}
+
+void PerimeterAssignment::EnvelopeTree::applyReset(unsigned node) {
+        Node& n = _nodes[node];
+        n.offset = INF;
+        n.minValue = INF;
+        n.reset = true;
+}
+
+void PerimeterAssignment::EnvelopeTree::push(unsigned node) {
+        Node& n = _nodes[node];
+        for (unsigned child = 2 * node; child <= 2 * node + 1; ++child) {
+                if (n.reset) {
+                        applyReset(child);
+                }
+                if (n.offset < INF) {
+                        applyMin(child, n.offset, n.pin);
+                }
+        }
+        n.reset = false;
+        n.offset = INF;
+}
+
+void PerimeterAssignment::EnvelopeTree::pushPath(unsigned leaf) {
+        for (unsigned level = _levels; level > 0; --level) {
+                push(leaf >> level);
+        }
+}
+
+void PerimeterAssignment::EnvelopeTree::pull(unsigned node) {
+        Node& n = _nodes[node];
+        const Node& a = _nodes[2 * node];
+        const Node& b = _nodes[2 * node + 1];
+        n.minW = std::min(a.minW, b.minW);
+        n.posW = a.minW <= b.minW ? a.posW : b.posW;
+        n.minValue = std::min(a.minValue, b.minValue);
+        n.pos = a.minValue <= b.minValue ? a.pos : b.pos;
+}
+
+void PerimeterAssignment::EnvelopeTree::setWeight(unsigned pos, DBU w) {
+        unsigned leaf = _size + pos;
+        pushPath(leaf);
+        Node& n = _nodes[leaf];
+        n.reset = false;
+        n.minW = w;
+        n.minValue = (w < INF && n.offset < INF) ? n.offset + w : INF;
+        for (leaf /= 2; leaf > 0; leaf /= 2) {
+                pull(leaf);
+        }
+}
+
+void PerimeterAssignment::EnvelopeTree::update(unsigned node,
+                                               unsigned nodeBegin,
+                                               unsigned nodeEnd,
+                                               unsigned begin, unsigned end,
+                                               DBU offset, unsigned pin) {
+        if (end <= nodeBegin || nodeEnd <= begin) {
+                return;
+        }
+        if (begin <= nodeBegin && nodeEnd <= end) {
+                applyMin(node, offset, pin);
+                return;
+        }
+        push(node);
+        unsigned middle = (nodeBegin + nodeEnd) / 2;
+        update(2 * node, nodeBegin, middle, begin, end, offset, pin);
+        update(2 * node + 1, middle, nodeEnd, begin, end, offset, pin);
+        pull(node);
+}
+
+void PerimeterAssignment::EnvelopeTree::updateMin(unsigned begin,
+                                                  unsigned end, DBU offset,
+                                                  unsigned pin) {
+        if (begin < end) {
+                update(1, 0, _size, begin, end, offset, pin);
+        }
+}
+
+unsigned PerimeterAssignment::EnvelopeTree::pinAt(unsigned pos) {
+        unsigned leaf = _size + pos;
+        pushPath(leaf);
+        return _nodes[leaf].pin;
+}
+
+PerimeterAssignment::PerimeterAssignment(const slotVector_t& slots)
+    : _slots(slots) {
+        buildRuns();
+}
+
+void PerimeterAssignment::buildRuns() {
+        std::vector<unsigned> freeSlots;
+        for (int i = _slots.findNextFree(0); i >= 0;
+             i = _slots.findNextFree(i + 1)) {
+                freeSlots.push_back(i);
+        }
+
+        // Slots are created along the edges, so a run grows while the
+        // slots keep the x (or y) of its first two slots
+        unsigned begin = 0;
+        while (begin < freeSlots.size()) {
+                const Coordinate first = _slots.pos(freeSlots[begin]);
+                unsigned end = begin + 1;
+                bool vertical = end < freeSlots.size() &&
+                                _slots.pos(freeSlots[end]).getX() ==
+                                    first.getX();
+                while (end < freeSlots.size()) {
+                        const Coordinate pos = _slots.pos(freeSlots[end]);
+                        if (vertical ? pos.getX() != first.getX()
+                                     : pos.getY() != first.getY()) {
+                                break;
+                        }
+                        ++end;
+                }
+                Run run = {vertical, vertical ? first.getX() : first.getY(),
+                           begin, end};
+                _runs.push_back(run);
+                begin = end;
+        }
+
+        _order = freeSlots;
+        _coord.resize(_order.size());
+        for (const Run& run : _runs) {
+                auto coordOf = [&](unsigned slot) {
+                        const Coordinate pos = _slots.pos(slot);
+                        return run.vertical ? pos.getY() : pos.getX();
+                };
+                std::sort(_order.begin() + run.begin,
+                          _order.begin() + run.end,
+                          [&](unsigned a, unsigned b) {
+                                  return coordOf(a) < coordOf(b);
+                          });
+                for (unsigned pos = run.begin; pos < run.end; ++pos) {
+                        _coord[pos] = coordOf(_order[pos]);
+                }
+        }
+}
+
+void PerimeterAssignment::setWeights(unsigned pos, bool visited) {
+        _left.setWeight(pos, visited ? INF : -_coord[pos] - _v[pos]);
+        _inside.setWeight(pos, visited ? INF : -_v[pos]);
+        _right.setWeight(pos, visited ? INF : _coord[pos] - _v[pos]);
+}
+
+DBU PerimeterAssignment::cost(unsigned pin, unsigned pos) const {
+        const Coordinate slot = _slots.pos(_order[pos]);
+        const DBU x = slot.getX();
+        const DBU y = slot.getY();
+        return (std::max(_maxX[pin], x) - std::min(_minX[pin], x)) +
+               (std::max(_maxY[pin], y) - std::min(_minY[pin], y));
+}
+
+DBU PerimeterAssignment::minCost(unsigned pin) const {
+        // The cost is convex along a run, so its minimum is at one of the
+        // two slots around the sink box
+        DBU best = INF;
+        for (const Run& run : _runs) {
+                DBU lo = run.vertical ? _minY[pin] : _minX[pin];
+                const DBU* coord = _coord.data();
+                unsigned pos =
+                    std::lower_bound(coord + run.begin, coord + run.end, lo) -
+                    coord;
+                if (pos < run.end) {
+                        best = std::min(best, cost(pin, pos));
+                }
+                if (pos > run.begin) {
+                        best = std::min(best, cost(pin, pos - 1));
+                }
+        }
+        return best;
+}
+
+void PerimeterAssignment::addPin(unsigned pin, DBU base) {
+        for (const Run& run : _runs) {
+                DBU lo, hi, span;
+                if (run.vertical) {
+                        lo = _minY[pin];
+                        hi = _maxY[pin];
+                        span = std::max(_maxX[pin], run.fixed) -
+                               std::min(_minX[pin], run.fixed);
+                } else {
+                        lo = _minX[pin];
+                        hi = _maxX[pin];
+                        span = std::max(_maxY[pin], run.fixed) -
+                               std::min(_minY[pin], run.fixed);
+                }
+                // Nets without sinks have an inverted box and cost zero
+                if (lo > hi) {
+                        _inside.updateMin(run.begin, run.end, base + span,
+                                          pin);
+                        continue;
+                }
+                const DBU* coord = _coord.data();
+                unsigned first =
+                    std::lower_bound(coord + run.begin, coord + run.end, lo) -
+                    coord;
+                unsigned last =
+                    std::upper_bound(coord + first, coord + run.end, hi) -
+                    coord;
+                _left.updateMin(run.begin, first, base + span + hi, pin);
+                _inside.updateMin(first, last, base + span + (hi - lo), pin);
+                _right.updateMin(last, run.end, base + span - lo, pin);
+        }
+}
+
+PerimeterAssignment::EnvelopeTree* PerimeterAssignment::cheapestTree() {
+        EnvelopeTree* tree = &_left;
+        if (_inside.minValue() < tree->minValue()) {
+                tree = &_inside;
+        }
+        if (_right.minValue() < tree->minValue()) {
+                tree = &_right;
+        }
+        return tree;
+}
+
+bool PerimeterAssignment::augment(unsigned freePin, std::vector<int>& rowSol) {
+        _touched.clear();
+        _left.reset();
+        _inside.reset();
+        _right.reset();
+        addPin(freePin, 0);
+
+        int endPos = -1;
+        DBU endDst = 0;
+        while (true) {
+                EnvelopeTree* tree = cheapestTree();
+                const DBU dst = tree->minValue();
+                if (dst >= INF) {
+                        break;
+                }
+                const unsigned pos = tree->minPos();
+                _touched.push_back(pos);
+                _d[pos] = dst;
+                _pred[pos] = tree->pinAt(pos);
+                setWeights(pos, true);
+                if (_colSol[pos] < 0) {
+                        endPos = pos;
+                        endDst = dst;
+                        break;
+                }
+
+                // The pin on the visited slot joins the search
+                unsigned pin = _colSol[pos];
+                addPin(pin, dst - (_assignedCost[pin] - _v[pos]));
+        }
+
+        if (endPos >= 0) {
+                for (unsigned pos : _touched) {
+                        _v[pos] += _d[pos] - endDst;
+                }
+
+                int pos = endPos;
+                unsigned pin;
+                do {
+                        pin = _pred[pos];
+                        int prevPos = rowSol[pin];
+                        _colSol[pos] = pin;
+                        rowSol[pin] = pos;
+                        _assignedCost[pin] = cost(pin, pos);
+                        pos = prevPos;
+                } while (pin != freePin);
+        }
+
+        for (unsigned pos : _touched) {
+                setWeights(pos, false);
+        }
+
+        return endPos >= 0;
+}
+
+bool PerimeterAssignment::solve(NetlistView& netlist,
+                                std::vector<int>& slotOfPin) {
+        const unsigned numPins = netlist.numIOPins();
+        const unsigned numPos = _order.size();
+        if (numPins > numPos) {
+                return false;
+        }
+
+        _minX.resize(numPins);
+        _minY.resize(numPins);
+        _maxX.resize(numPins);
+        _maxY.resize(numPins);
+        for (unsigned idx = 0; idx < numPins; ++idx) {
+                const Box& box = netlist.getSinksBB(idx);
+                _minX[idx] = box.getLowerBound().getX();
+                _minY[idx] = box.getLowerBound().getY();
+                _maxX[idx] = box.getUpperBound().getX();
+                _maxY[idx] = box.getUpperBound().getY();
+        }
+
+        // Slots that are never assigned keep a zero price, as in
+        // SparseAssignmentSolver
+        _v.assign(numPos, 0);
+        _d.assign(numPos, INF);
+        _colSol.assign(numPos, -1);
+        _pred.assign(numPos, -1);
+        _assignedCost.assign(numPins, 0);
+        _left.init(numPos);
+        _inside.init(numPos);
+        _right.init(numPos);
+        for (unsigned pos = 0; pos < numPos; ++pos) {
+                setWeights(pos, false);
+        }
+
+        // With zero prices, a pin on one of its cheapest slots keeps the
+        // reduced costs nonnegative, so the pins that find one free skip
+        // the search
+        std::vector<int> rowSol(numPins, -1);
+        std::vector<unsigned> pending;
+        for (unsigned pin = 0; pin < numPins; ++pin) {
+                _left.reset();
+                _inside.reset();
+                _right.reset();
+                addPin(pin, 0);
+                EnvelopeTree* tree = cheapestTree();
+                const unsigned pos = tree->minPos();
+                if (tree->minValue() == minCost(pin)) {
+                        _colSol[pos] = pin;
+                        rowSol[pin] = pos;
+                        _assignedCost[pin] = tree->minValue();
+                        setWeights(pos, true);
+                } else {
+                        pending.push_back(pin);
+                }
+        }
+        for (unsigned pin = 0; pin < numPins; ++pin) {
+                if (rowSol[pin] >= 0) {
+                        setWeights(rowSol[pin], false);
+                }
+        }
+
+        for (unsigned pin : pending) {
+                if (not augment(pin, rowSol)) {
+                        return false;
+                }
+        }
+
+        slotOfPin.resize(numPins);
+        for (unsigned pin = 0; pin < numPins; ++pin) {
+                slotOfPin[pin] = _order[rowSol[pin]];
+        }
+        return true;
+}
@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PERIMETERASSIGNMENT_H_
+#define __PERIMETERASSIGNMENT_H_
+
+#include <vector>
+
+#include "Netlist.h"
+#include "Slots.h"
+
+// Exact assignment of every IO pin to the free slots of the whole boundary,
+// without sections and without a cost matrix. The slots form a few runs on
+// straight lines (one per edge). On a run, the HPWL of a net is a constant
+// (the span along the fixed axis) plus a piecewise linear function of the
+// slot coordinate t with three pieces given by the sink box [lo, hi]:
+// hi - t before it, hi - lo inside it and t - lo after it.
+//
+// The solver is the shortest augmenting path method of
+// SparseAssignmentSolver, with slot prices v. Instead of relaxing every
+// slot, a pin reached by the search lowers the tentative distance of whole
+// ranges at once: each piece is a constant offset plus -t, 0 or t, so one
+// segment tree per slope keeps, for each slot, the smallest offset (and its
+// pin) of the pieces covering it, and the minimum of offset + w over its
+// unvisited slots, with w = -t - v, -v or t - v. An augmentation costs
+// O((k + p) log m) for k visited slots and p reached pins instead of
+// O(n m), and memory is linear in pins and slots.
+class PerimeterAssignment {
+       private:
+        // Slots weighted by w, with range updates "offset = min(offset,
+        // a)" and the query of the minimum of offset + w. Offsets start
+        // at infinity after reset.
+        class EnvelopeTree {
+               private:
+                struct Node {
+                        DBU minW;
+                        unsigned posW;
+                        DBU minValue;
+                        unsigned pos;
+                        // Offset of a leaf, pending update of a node
+                        DBU offset;
+                        unsigned pin;
+                        bool reset;
+                };
+                unsigned _size = 1;
+                unsigned _levels = 0;
+                std::vector<Node> _nodes;
+
+                void applyMin(unsigned node, DBU offset, unsigned pin);
+                void applyReset(unsigned node);
+                void push(unsigned node);
+                void pushPath(unsigned leaf);
+                void pull(unsigned node);
+                void update(unsigned node, unsigned nodeBegin,
+                            unsigned nodeEnd, unsigned begin, unsigned end,
+                            DBU offset, unsigned pin);
+
+               public:
+                void init(unsigned size);
+                void reset() { applyReset(1); }
+                void setWeight(unsigned pos, DBU w);
+                void updateMin(unsigned begin, unsigned end, DBU offset,
+                               unsigned pin);
+                DBU minValue() const { return _nodes[1].minValue; }
+                unsigned minPos() const { return _nodes[1].pos; }
+                // Pin of the smallest offset at pos
+                unsigned pinAt(unsigned pos);
+        };
+
+        // Slots of a line, sorted by their coordinate along it
+        struct Run {
+                bool vertical;
+                DBU fixed;
+                unsigned begin;
+                unsigned end;
+        };
+
+        const slotVector_t& _slots;
+        std::vector<Run> _runs;
+        // Free slots grouped by run and sorted along it; the position of a
+        // slot in this order indexes the trees and the vectors below
+        std::vector<unsigned> _order;
+        std::vector<DBU> _coord;
+        std::vector<DBU> _v;
+        std::vector<DBU> _d;
+        std::vector<int> _colSol;
+        std::vector<int> _pred;
+        std::vector<unsigned> _touched;
+        std::vector<DBU> _assignedCost;
+        std::vector<DBU> _minX;
+        std::vector<DBU> _minY;
+        std::vector<DBU> _maxX;
+        std::vector<DBU> _maxY;
+        // Pieces of slope -1, 0 and +1 along the runs
+        EnvelopeTree _left;
+        EnvelopeTree _inside;
+        EnvelopeTree _right;
+
+        void buildRuns();
+        void setWeights(unsigned pos, bool visited);
+        DBU cost(unsigned pin, unsigned pos) const;
+        DBU minCost(unsigned pin) const;
+        EnvelopeTree* cheapestTree();
+        void addPin(unsigned pin, DBU base);
+        bool augment(unsigned freePin, std::vector<int>& rowSol);
+
+       public:
+        explicit PerimeterAssignment(const slotVector_t&);
+        unsigned numFreeSlots() const { return _order.size(); }
+        // Returns false when there are more pins than free slots. On
+        // success, slotOfPin[idx] is the index of the slot of each pin.
+        bool solve(NetlistView&, std::vector<int>& slotOfPin);
+};
+
+#endif /* __PERIMETERASSIGNMENT_H_ */
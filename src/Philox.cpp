@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Philox.h"
+
+#include <algorithm>
+
+void Philox::permutation(unsigned n, std::vector<unsigned>& perm) const {
+        std::vector<uint64_t> numbers(n);
+#pragma omp parallel for
+        for (unsigned i = 0; i < n; ++i) {
+                numbers[i] = (*this)(i);
+        }
+
+        // n buckets by the top bits of the numbers, about one index each
+        auto bucketOf = [&](unsigned i) {
+                return unsigned(((numbers[i] >> 32) * n) >> 32);
+        };
+        std::vector<unsigned> bucketBegin(n + 1, 0);
+        for (unsigned i = 0; i < n; ++i) {
+                ++bucketBegin[bucketOf(i) + 1];
+        }
+        for (unsigned b = 0; b < n; ++b) {
+                bucketBegin[b + 1] += bucketBegin[b];
+        }
+        std::vector<unsigned> fill(bucketBegin.begin(), bucketBegin.end() - 1);
+        perm.resize(n);
+        for (unsigned i = 0; i < n; ++i) {
+                perm[fill[bucketOf(i)]++] = i;
+        }
+
+        // Ties between equal numbers keep the index order, so the result is
+        // a function of the seed only
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (unsigned b = 0; b < n; ++b) {
+                std::sort(perm.begin() + bucketBegin[b],
+                          perm.begin() + bucketBegin[b + 1],
+                          [&](unsigned x, unsigned y) {
+                                  return numbers[x] < numbers[y] ||
+                                         (numbers[x] == numbers[y] && x < y);
+                          });
+        }
+}
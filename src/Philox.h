@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PHILOX_H_
+#define __PHILOX_H_
+
+#include <cstdint>
+#include <vector>
+
+// Philox4x32-10 counter-based generator (Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3", SC 2011). The value for a counter depends
+// only on the key and the counter, so any thread can draw the i-th number
+// and the results do not depend on the number of threads.
+class Philox {
+       private:
+        uint32_t _key[2];
+
+       public:
+        explicit Philox(uint64_t seed) {
+                _key[0] = seed;
+                _key[1] = seed >> 32;
+        }
+
+        uint64_t operator()(uint64_t counter) const {
+                uint32_t c[4] = {uint32_t(counter), uint32_t(counter >> 32),
+                                 0, 0};
+                uint32_t k0 = _key[0];
+                uint32_t k1 = _key[1];
+                for (int round = 0; round < 10; ++round) {
+                        uint64_t p0 = uint64_t(0xD2511F53) * c[0];
+                        uint64_t p1 = uint64_t(0xCD9E8D57) * c[2];
+                        uint32_t next[4] = {uint32_t(p1 >> 32) ^ c[1] ^ k0,
+                                            uint32_t(p1),
+                                            uint32_t(p0 >> 32) ^ c[3] ^ k1,
+                                            uint32_t(p0)};
+                        c[0] = next[0];
+                        c[1] = next[1];
+                        c[2] = next[2];
+                        c[3] = next[3];
+                        k0 += 0x9E3779B9;
+                        k1 += 0xBB67AE85;
+                }
+                return uint64_t(c[0]) | (uint64_t(c[1]) << 32);
+        }
+
+        // Random permutation of 0..n-1: the order of the indexes by their
+        // number, found in expected O(n) by bucketing the numbers
+        void permutation(unsigned n, std::vector<unsigned>& perm) const;
+};
+
+#endif /* __PHILOX_H_ */
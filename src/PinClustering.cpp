@@ -0,0 +1,210 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "PinClustering.h"
+
+#include <algorithm>
+
+#include "CostKernel.h"
+
+PinClustering::PinClustering(const Core& core, const slotVector_t& slots,
+                             unsigned clusterSize)
+    : _core(core), _slots(slots), _clusterSize(std::max(clusterSize, 1u)) {
+        for (int i = _slots.findNextFree(0); i >= 0;
+             i = _slots.findNextFree(i + 1)) {
+                _freeSlots.push_back(i);
+        }
+}
+
+// Distance along the boundary from the lower left corner to the boundary
+// point closest to the center of the net, following the order of
+// defineSlots: bottom, right, top and left edges
+DBU PinClustering::projectNet(const Box& box) const {
+        const DBU lbX = _core.getLowerBound().getX();
+        const DBU lbY = _core.getLowerBound().getY();
+        const DBU ubX = _core.getUpperBound().getX();
+        const DBU ubY = _core.getUpperBound().getY();
+        const DBU width = ubX - lbX;
+        const DBU height = ubY - lbY;
+
+        Coordinate lower = box.getLowerBound();
+        Coordinate upper = box.getUpperBound();
+        DBU x = std::min(std::max((lower.getX() + upper.getX()) / 2, lbX), ubX);
+        DBU y = std::min(std::max((lower.getY() + upper.getY()) / 2, lbY), ubY);
+
+        DBU bottom = y - lbY;
+        DBU right = ubX - x;
+        DBU top = ubY - y;
+        DBU left = x - lbX;
+        DBU closest = std::min(std::min(bottom, right), std::min(top, left));
+        if (closest == bottom) {
+                return x - lbX;
+        }
+        if (closest == right) {
+                return width + (y - lbY);
+        }
+        if (closest == top) {
+                return width + height + (ubX - x);
+        }
+        return 2 * width + height + (ubY - y);
+}
+
+void PinClustering::coarsen(NetlistView& netlist,
+                            std::vector<Cluster>& clusters) {
+        const unsigned numPins = netlist.numIOPins();
+        const unsigned numFree = _freeSlots.size();
+
+        std::vector<std::pair<DBU, unsigned>> order(numPins);
+        for (unsigned idx = 0; idx < numPins; ++idx) {
+                order[idx] =
+                    std::make_pair(projectNet(netlist.getSinksBB(idx)), idx);
+        }
+        std::sort(order.begin(), order.end());
+
+        // Clusters of balanced sizes. Each segment holds the largest
+        // cluster, so more clusters are used when the slots are scarce.
+        unsigned numClusters = (numPins + _clusterSize - 1) / _clusterSize;
+        while (numFree / ((numPins + numClusters - 1) / numClusters) <
+               numClusters) {
+                numClusters++;
+        }
+        clusters.assign(numClusters, Cluster());
+        for (unsigned k = 0; k < numPins; ++k) {
+                unsigned cluster = (uint64_t)k * numClusters / numPins;
+                clusters[cluster].pins.push_back(order[k].second);
+        }
+}
+
+void PinClustering::assignSegments(NetlistView& netlist,
+                                   std::vector<Cluster>& clusters) {
+        const unsigned numPins = netlist.numIOPins();
+        const unsigned numFree = _freeSlots.size();
+        const unsigned numClusters = clusters.size();
+
+        // Segments as small as the largest cluster, so that the clusters
+        // can fill the free slots where the nets concentrate
+        unsigned maxSize = (numPins + numClusters - 1) / numClusters;
+        unsigned numSegments = numFree / maxSize;
+
+        std::vector<unsigned> segmentBegin(numSegments + 1);
+        CostData data;
+        for (unsigned s = 0; s <= numSegments; ++s) {
+                segmentBegin[s] = (uint64_t)s * numFree / numSegments;
+        }
+        for (unsigned s = 0; s < numSegments; ++s) {
+                unsigned middle = (segmentBegin[s] + segmentBegin[s + 1]) / 2;
+                data.addSlot(_slots.pos(_freeSlots[middle]));
+        }
+        for (unsigned idx = 0; idx < numPins; ++idx) {
+                data.addNet(netlist.getSinksBB(idx));
+        }
+
+        // Cost of a cluster at a segment: HPWL of its nets at the middle
+        Matrix<DBU> costs(numClusters, numSegments);
+#pragma omp parallel
+        {
+                std::vector<DBU> row(numSegments);
+#pragma omp for
+                for (int c = 0; c < (int)numClusters; ++c) {
+                        DBU* clusterCosts = costs.row(c);
+                        std::fill(clusterCosts, clusterCosts + numSegments, 0);
+                        for (unsigned pin : clusters[c].pins) {
+                                CostKernel::computeRow(data, pin, row.data());
+                                for (unsigned s = 0; s < numSegments; ++s) {
+                                        clusterCosts[s] += row[s];
+                                }
+                        }
+                }
+        }
+
+        std::vector<int> segmentOf;
+        AssignmentSolver::create(SOLVER_LAPJV)->solve(costs, segmentOf);
+        for (unsigned c = 0; c < numClusters; ++c) {
+                unsigned s = segmentOf[c];
+                clusters[c].begin = segmentBegin[s];
+                clusters[c].width = segmentBegin[s + 1] - segmentBegin[s];
+        }
+}
+
+void PinClustering::createSections(NetlistView& netlist,
+                                   sectionVector_t& sections) {
+        sections.clear();
+        if (netlist.numIOPins() == 0) {
+                return;
+        }
+
+        std::vector<Cluster> clusters;
+        coarsen(netlist, clusters);
+        assignSegments(netlist, clusters);
+
+        // Free slots of the segments left without a cluster are split
+        // between the segments around them, giving the matcher more room
+        std::sort(clusters.begin(), clusters.end(),
+                  [](const Cluster& a, const Cluster& b) {
+                          return a.begin < b.begin;
+                  });
+        unsigned begin = 0;
+        for (unsigned k = 0; k < clusters.size(); ++k) {
+                unsigned end = _freeSlots.size();
+                if (k + 1 < clusters.size()) {
+                        unsigned used = clusters[k].begin + clusters[k].width;
+                        end = used + (clusters[k + 1].begin - used) / 2;
+                }
+                clusters[k].width = end - begin;
+                clusters[k].begin = begin;
+                begin = end;
+        }
+
+        // Uncoarsen: each cluster is a section over its segment
+        for (const Cluster& cluster : clusters) {
+                unsigned first = _freeSlots[cluster.begin];
+                unsigned last = _freeSlots[cluster.begin + cluster.width - 1];
+                unsigned middle =
+                    _freeSlots[cluster.begin + cluster.width / 2];
+                Section_t section = {_slots.pos(middle)};
+                section.net = NetlistView(netlist.getNetlist());
+                section.beginSlot = first;
+                section.endSlot = last + 1;
+                section.numSlots = cluster.width;
+                section.maxSlots = cluster.width;
+                section.curSlots = cluster.pins.size();
+                for (unsigned idx : cluster.pins) {
+                        section.net.addIONet(netlist.netlistIdx(idx));
+                }
+                sections.push_back(section);
+        }
+}
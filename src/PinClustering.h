@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __PINCLUSTERING_H_
+#define __PINCLUSTERING_H_
+
+#include <vector>
+
+#include "AssignmentSolver.h"
+#include "Core.h"
+#include "Netlist.h"
+#include "Slots.h"
+
+// Multilevel section setup for designs with many I/O pins:
+// 1. coarsen: pins are sorted by the boundary point closest to the center of
+//    their nets and cut into clusters of at most clusterSize pins;
+// 2. the free slots are cut into segments that fit the largest cluster, and
+//    clusters are matched to segments by LAPJV, with the cost of a cluster at
+//    a segment being the HPWL of its nets at the middle of the segment;
+// 3. uncoarsen: each cluster becomes a section over its segment, extended
+//    over the unused segments next to it, that the matcher then refines.
+// The cluster problem has n / clusterSize rows, so the setup takes
+// O(n log n + n^2 / clusterSize) and never needs the retry loop of
+// setupSections.
+class PinClustering {
+       private:
+        struct Cluster {
+                std::vector<unsigned> pins;
+                unsigned begin;
+                unsigned width;
+        };
+
+        const Core& _core;
+        const slotVector_t& _slots;
+        unsigned _clusterSize;
+        // Indexes of the free slots, in boundary order
+        std::vector<unsigned> _freeSlots;
+
+        DBU projectNet(const Box&) const;
+        void coarsen(NetlistView&, std::vector<Cluster>&);
+        void assignSegments(NetlistView&, std::vector<Cluster>&);
+
+       public:
+        PinClustering(const Core&, const slotVector_t&, unsigned clusterSize);
+        unsigned numFreeSlots() const { return _freeSlots.size(); }
+        void createSections(NetlistView&, sectionVector_t&);
+};
+
+#endif /* __PINCLUSTERING_H_ */
@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SectionIndex.h"
+
+#include <algorithm>
+
+// Min-heap on the cost, then on the section index
+bool SectionIndex::later(const Frontier& a, const Frontier& b) {
+        return a.cost > b.cost || (a.cost == b.cost && a.section > b.section);
+}
+
+void SectionIndex::build(const sectionVector_t& sections) {
+        _sections = &sections;
+        _runs.clear();
+
+        // Sections are created along the edges, so a run grows while the
+        // positions keep the x (or y) of its first two sections
+        unsigned begin = 0;
+        while (begin < sections.size()) {
+                const Coordinate& first = sections[begin].pos;
+                unsigned end = begin + 1;
+                bool vertical = end < sections.size() &&
+                                sections[end].pos.getX() == first.getX();
+                while (end < sections.size()) {
+                        const Coordinate& pos = sections[end].pos;
+                        if (vertical ? pos.getX() != first.getX()
+                                     : pos.getY() != first.getY()) {
+                                break;
+                        }
+                        ++end;
+                }
+                _runs.push_back({begin, end});
+                begin = end;
+        }
+        _heap.reserve(2 * _runs.size());
+}
+
+DBU SectionIndex::cost(unsigned section) const {
+        return _netlist->computeIONetHPWL(_ioIdx, (*_sections)[section].pos);
+}
+
+void SectionIndex::push(unsigned run, int section, int step) {
+        if (section < (int)_runs[run].begin || section >= (int)_runs[run].end) {
+                return;
+        }
+        _heap.push_back({cost(section), (unsigned)section, run, step});
+        std::push_heap(_heap.begin(), _heap.end(), later);
+}
+
+void SectionIndex::begin(NetlistView& netlist, unsigned idx) {
+        _netlist = &netlist;
+        _ioIdx = idx;
+        _heap.clear();
+
+        for (unsigned run = 0; run < _runs.size(); ++run) {
+                // The cost differences along the run are non-decreasing, so
+                // the first section not more expensive than the next one is
+                // the cheapest of the run
+                unsigned low = _runs[run].begin;
+                unsigned high = _runs[run].end - 1;
+                while (low < high) {
+                        unsigned mid = low + (high - low) / 2;
+                        if (cost(mid) <= cost(mid + 1)) {
+                                high = mid;
+                        } else {
+                                low = mid + 1;
+                        }
+                }
+                push(run, low, 0);
+        }
+}
+
+int SectionIndex::next() {
+        if (_heap.empty()) {
+                return -1;
+        }
+        std::pop_heap(_heap.begin(), _heap.end(), later);
+        Frontier top = _heap.back();
+        _heap.pop_back();
+
+        // The minimum of a run expands both ways, the others keep going
+        if (top.step <= 0) {
+                push(top.run, (int)top.section - 1, -1);
+        }
+        if (top.step >= 0) {
+                push(top.run, (int)top.section + 1, 1);
+        }
+        return top.section;
+}
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SECTIONINDEX_H_
+#define __SECTIONINDEX_H_
+
+#include <vector>
+
+#include "Netlist.h"
+#include "Slots.h"
+
+// Visits the sections by increasing HPWL of an IO net without computing the
+// cost of every section. Sections follow the core boundary, so they form a
+// few runs of positions on a straight line (one per edge). Along a run the
+// HPWL is a convex function of the position: the cheapest section of each
+// run is found by binary search, and the visit then expands outwards from
+// it in both directions, merging the runs by cost. Sections of equal cost
+// are visited in a fixed order.
+class SectionIndex {
+       private:
+        struct Run {
+                unsigned begin;
+                unsigned end;
+        };
+
+        struct Frontier {
+                DBU cost;
+                unsigned section;
+                unsigned run;
+                int step;
+        };
+
+        const sectionVector_t* _sections = nullptr;
+        std::vector<Run> _runs;
+        std::vector<Frontier> _heap;
+        NetlistView* _netlist = nullptr;
+        unsigned _ioIdx = 0;
+
+        static bool later(const Frontier&, const Frontier&);
+        DBU cost(unsigned section) const;
+        void push(unsigned run, int section, int step);
+
+       public:
+        void build(const sectionVector_t&);
+        // Starts a visit for the IO net idx of the netlist
+        void begin(NetlistView&, unsigned idx);
+        // Next section of the visit, or -1 after the last one
+        int next();
+};
+
+#endif /* __SECTIONINDEX_H_ */
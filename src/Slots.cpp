@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Slots.h"
+
+// Tracks from first up to (excluding) upper, one every pitch
+static unsigned numTracks(DBU first, DBU upper, DBU pitch) {
+        return first < upper ? (upper - first + pitch - 1) / pitch : 0;
+}
+
+void SlotVector::init(const Core& core) {
+        _lowerX = core.getLowerBound().getX();
+        _lowerY = core.getLowerBound().getY();
+        _upperX = core.getUpperBound().getX();
+        _upperY = core.getUpperBound().getY();
+        _firstX = core.getInitTracksX();
+        _firstY = core.getInitTracksY();
+        _pitchX = core.getMinDstPinsX();
+        _pitchY = core.getMinDstPinsY();
+        _numX = numTracks(_firstX, _upperX, _pitchX);
+        _numY = numTracks(_firstY, _upperY, _pitchY);
+        _blocked.assign((size() + 63) / 64, 0);
+        _used.assign((size() + 63) / 64, 0);
+}
+
+int SlotVector::indexOf(const Coordinate& pos) const {
+        const DBU x = pos.getX();
+        const DBU y = pos.getY();
+        const bool onTrackX = x >= _firstX && (x - _firstX) % _pitchX == 0 &&
+                              (x - _firstX) / _pitchX < _numX;
+        const bool onTrackY = y >= _firstY && (y - _firstY) % _pitchY == 0 &&
+                              (y - _firstY) / _pitchY < _numY;
+        if (onTrackX && y == _lowerY) {
+                return (x - _firstX) / _pitchX;
+        }
+        if (onTrackY && x == _upperX) {
+                return edgeBegin(EDGE_RIGHT) + (y - _firstY) / _pitchY;
+        }
+        if (onTrackX && y == _upperY) {
+                return edgeBegin(EDGE_TOP) + _numX - 1 -
+                       (x - _firstX) / _pitchX;
+        }
+        if (onTrackY && x == _lowerX) {
+                return edgeBegin(EDGE_LEFT) + _numY - 1 -
+                       (y - _firstY) / _pitchY;
+        }
+        return -1;
+}
+
+uint64_t SlotVector::freeWord(unsigned word) const {
+        uint64_t free = ~(_blocked[word] | _used[word]);
+        if (word == size() / 64) {
+                free &= bit(size()) - 1;
+        }
+        return free;
+}
+
+int SlotVector::findNextFree(unsigned from) const {
+        if (from >= size()) {
+                return -1;
+        }
+        unsigned word = from / 64;
+        uint64_t free = freeWord(word) & ~(bit(from) - 1);
+        while (free == 0) {
+                if (++word >= _used.size()) {
+                        return -1;
+                }
+                free = freeWord(word);
+        }
+        return word * 64 + __builtin_ctzll(free);
+}
+
+unsigned SlotVector::countFree(unsigned begin, unsigned end) const {
+        unsigned count = 0;
+        for (unsigned word = begin / 64; word * 64 < end; ++word) {
+                uint64_t free = freeWord(word);
+                if (word == begin / 64) {
+                        free &= ~(bit(begin) - 1);
+                }
+                if (word == end / 64) {
+                        free &= bit(end) - 1;
+                }
+                count += __builtin_popcountll(free);
+        }
+        return count;
+}
+
+unsigned SlotVector::reserve(unsigned begin, unsigned count,
+                             std::vector<unsigned>& slots) {
+        if (begin >= size()) {
+                return 0;
+        }
+        unsigned reserved = 0;
+        unsigned word = begin / 64;
+        for (; word < _used.size() && reserved < count; ++word) {
+                uint64_t free = freeWord(word);
+                if (word == begin / 64) {
+                        free &= ~(bit(begin) - 1);
+                }
+                // Takes the free slots of the word in order, up to count
+                uint64_t taken = 0;
+                while (free != 0 && reserved < count) {
+                        uint64_t lowest = free & (~free + 1);
+                        slots.push_back(word * 64 + __builtin_ctzll(free));
+                        taken |= lowest;
+                        free ^= lowest;
+                        ++reserved;
+                }
+#pragma omp atomic
+                _used[word] |= taken;
+        }
+        return reserved;
+}
@@ -41,23 +41,119 @@
 #define MAX_SLOTS_RECOMMENDED 600
 #define MAX_SECTIONS_RECOMMENDED 600
 
+#include <cstdint>
 #include <vector>
 
 #include "Coordinate.h"
+#include "Core.h"
 #include "Netlist.h"
-#include <numeric>
 
-struct _Slot_t {
-        bool blocked;
-        bool used;
-        Coordinate pos;
-} typedef Slot_t;
+// Core edges in the order the slots walk them
+enum Edge { EDGE_BOTTOM, EDGE_RIGHT, EDGE_TOP, EDGE_LEFT };
+
+// Slots of the core boundary: the bottom edge left to right, the right edge
+// bottom up, the top edge right to left and the left edge top down, one
+// slot every pin pitch from the first track. Positions follow from the
+// index, so only the blocked and used flags are stored, one bit per slot.
+// Sections mark their slots as used in parallel and neighbouring sections
+// may share a word, so the used words are updated atomically.
+class SlotVector {
+       private:
+        DBU _lowerX = 0;
+        DBU _lowerY = 0;
+        DBU _upperX = 0;
+        DBU _upperY = 0;
+        DBU _firstX = 0;
+        DBU _firstY = 0;
+        DBU _pitchX = 1;
+        DBU _pitchY = 1;
+        // Slots on the bottom (and top) edge, and on the right (and left)
+        unsigned _numX = 0;
+        unsigned _numY = 0;
+        std::vector<uint64_t> _blocked;
+        std::vector<uint64_t> _used;
+
+        static uint64_t bit(unsigned slot) {
+                return uint64_t(1) << (slot % 64);
+        }
+        // Free slots of a word, without the bits past the last slot
+        uint64_t freeWord(unsigned word) const;
+
+       public:
+        void init(const Core&);
+        unsigned size() const { return 2 * (_numX + _numY); }
+
+        unsigned edgeBegin(Edge edge) const {
+                return (edge + 1) / 2 * _numX + edge / 2 * _numY;
+        }
+        unsigned edgeEnd(Edge edge) const {
+                return edge == EDGE_LEFT ? size() : edgeBegin(Edge(edge + 1));
+        }
+
+        Coordinate pos(unsigned slot) const {
+                if (slot < _numX) {
+                        return Coordinate(_firstX + slot * _pitchX, _lowerY);
+                }
+                slot -= _numX;
+                if (slot < _numY) {
+                        return Coordinate(_upperX, _firstY + slot * _pitchY);
+                }
+                slot -= _numY;
+                if (slot < _numX) {
+                        return Coordinate(
+                            _firstX + (_numX - 1 - slot) * _pitchX, _upperY);
+                }
+                slot -= _numX;
+                return Coordinate(_lowerX,
+                                  _firstY + (_numY - 1 - slot) * _pitchY);
+        }
+        // Index of the slot at pos, -1 if there is none
+        int indexOf(const Coordinate& pos) const;
+
+        bool isBlocked(unsigned slot) const {
+                return _blocked[slot / 64] & bit(slot);
+        }
+        void setBlocked(unsigned slot, bool blocked) {
+                if (blocked) {
+                        _blocked[slot / 64] |= bit(slot);
+                } else {
+                        _blocked[slot / 64] &= ~bit(slot);
+                }
+        }
+        bool isUsed(unsigned slot) const {
+                uint64_t word;
+#pragma omp atomic read
+                word = _used[slot / 64];
+                return word & bit(slot);
+        }
+        void setUsed(unsigned slot, bool used) {
+                uint64_t& word = _used[slot / 64];
+                if (used) {
+#pragma omp atomic
+                        word |= bit(slot);
+                } else {
+#pragma omp atomic
+                        word &= ~bit(slot);
+                }
+        }
+
+        // Free-slot allocator: a slot is free when it is neither blocked
+        // nor used. The searches skip a whole word of full slots at a time.
+        // First free slot at or after from, -1 if there is none
+        int findNextFree(unsigned from) const;
+        // Free slots in [begin, end)
+        unsigned countFree(unsigned begin, unsigned end) const;
+        // Marks up to count free slots from begin on as used, in order, and
+        // appends them to slots; returns how many were reserved
+        unsigned reserve(unsigned begin, unsigned count,
+                         std::vector<unsigned>& slots);
+};
 
-typedef std::vector<Slot_t> slotVector_t;
+typedef SlotVector slotVector_t;
 
 typedef struct _Section_t {
         Coordinate pos;
-        Netlist net;
+        NetlistView net;
         unsigned cost;
         unsigned beginSlot;
         unsigned endSlot;
@@ -68,15 +164,11 @@ typedef struct _Section_t {
 
 typedef std::vector<Section_t> sectionVector_t;
 
-template <typename T>
-std::vector<size_t> sort_indexes(const std::vector<T>& v) {
-        // initialize original index locations
-        std::vector<size_t> idx(v.size());
-        std::iota(idx.begin(), idx.end(), 0);
-        // sort indexes based on comparing values in v
-        std::sort(idx.begin(), idx.end(),
-                  [&v](size_t i1, size_t i2) { return v[i1] < v[i2]; });
-        return idx;
-}
+// IO pin idx of a section netlist, committed to a slot
+struct AssignedPin {
+        NetlistView* net;
+        unsigned idx;
+        unsigned slot;
+};
 
 #endif /* __SLOTS_H */
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SolverWorkspace.h"
+
+#include <algorithm>
+
+void SolverWorkspace::init(SolverType solverType, unsigned maxPins,
+                           unsigned maxSlots, unsigned numCandidates) {
+        solver = AssignmentSolver::create(solverType);
+        solver->reserve(maxPins, maxSlots);
+
+        const size_t maxSize = std::max(maxPins, maxSlots);
+        const size_t size = (size_t)maxPins * maxSize;
+        // Munkres pads the 64-bit costs to a square matrix in place
+        costs.reserve(solverType == SOLVER_MUNKRES ? maxSize * maxSize : size);
+        compactCosts.reserve(size);
+        costData.reserve(maxPins, maxSlots);
+        costRow.reserve(maxSlots);
+
+        sparseSolver.reserve(maxPins, maxSlots);
+        sparseMatrix.rowPtr.reserve(maxPins + 1);
+        const size_t numEdges =
+            (size_t)maxPins * std::min(numCandidates, maxSlots);
+        sparseMatrix.slots.reserve(numEdges);
+        sparseMatrix.costs.reserve(numEdges);
+        slotCosts.reserve(maxSlots);
+        candidates.reserve(maxSlots);
+        candidateCosts.reserve(maxSlots);
+
+        initSlots.reserve(maxPins);
+        initPrices.reserve(maxSlots);
+}
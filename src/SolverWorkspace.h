@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SOLVERWORKSPACE_H_
+#define __SOLVERWORKSPACE_H_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "munkres/munkres.h"
+
+#include "AssignmentSolver.h"
+#include "Coordinate.h"
+#include "CostKernel.h"
+#include "SparseAssignment.h"
+
+// Buffers of one thread for solving sections. The kernel sizes each
+// workspace once for its largest section and the sections solved by that
+// thread reuse it, so the solve phase does not allocate in steady state.
+struct SolverWorkspace {
+        std::unique_ptr<AssignmentSolver> solver;
+        Matrix<DBU> costs;
+        Matrix<CompactCost> compactCosts;
+        CostData costData;
+        std::vector<DBU> costRow;
+
+        // Sparse mode: candidate costs of one pin and the CSR matrix
+        SparseAssignmentSolver sparseSolver;
+        SparseCostMatrix sparseMatrix;
+        std::vector<std::pair<DBU, unsigned>> slotCosts;
+        std::vector<unsigned> candidates;
+        std::vector<DBU> candidateCosts;
+
+        // Warm start: the initial matching and prices given to the solver
+        std::vector<int> initSlots;
+        std::vector<DBU> initPrices;
+
+        // numCandidates is the initial K of the sparse mode, 0 if disabled
+        void init(SolverType, unsigned maxPins, unsigned maxSlots,
+                  unsigned numCandidates = 0);
+};
+
+#endif /* __SOLVERWORKSPACE_H_ */
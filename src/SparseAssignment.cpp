@@ -0,0 +1,312 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SparseAssignment.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+
+static const DBU BIG = std::numeric_limits<DBU>::max() / 4;
+
+void SparseCostMatrix::clear(unsigned pins, unsigned slots) {
+        numPins = 0;
+        numSlots = slots;
+        rowPtr.clear();
+        rowPtr.reserve(pins + 1);
+        rowPtr.push_back(0);
+        this->slots.clear();
+        costs.clear();
+}
+
+void SparseCostMatrix::addPin(const std::vector<unsigned>& candidates,
+                              const std::vector<DBU>& candidateCosts) {
+        slots.insert(slots.end(), candidates.begin(), candidates.end());
+        costs.insert(costs.end(), candidateCosts.begin(),
+                     candidateCosts.end());
+        rowPtr.push_back(slots.size());
+        numPins++;
+}
+
+bool SparseAssignmentSolver::augment(const SparseCostMatrix& matrix,
+                                     unsigned freePin,
+                                     std::vector<int>& rowSol) {
+        // Min-heap kept in a member buffer, so that it keeps its capacity
+        std::greater<HeapItem> compare;
+        _heap.clear();
+        _settled.clear();
+        _touched.clear();
+
+        for (unsigned e = matrix.rowPtr[freePin];
+             e < matrix.rowPtr[freePin + 1]; ++e) {
+                unsigned slot = matrix.slots[e];
+                DBU dst = matrix.costs[e] - _v[slot];
+                if (dst < _d[slot]) {
+                        if (_d[slot] == BIG) _touched.push_back(slot);
+                        _d[slot] = dst;
+                        _pred[slot] = freePin;
+                        _predCost[slot] = matrix.costs[e];
+                        _heap.push_back(HeapItem(dst, slot));
+                        std::push_heap(_heap.begin(), _heap.end(), compare);
+                }
+        }
+
+        int endSlot = -1;
+        DBU endDst = 0;
+        while (!_heap.empty()) {
+                std::pop_heap(_heap.begin(), _heap.end(), compare);
+                HeapItem item = _heap.back();
+                _heap.pop_back();
+                unsigned slot = item.second;
+                if (_visited[slot] || item.first > _d[slot]) continue;
+                _visited[slot] = true;
+
+                if (_colSol[slot] < 0) {
+                        endSlot = slot;
+                        endDst = item.first;
+                        break;
+                }
+                _settled.push_back(slot);
+
+                // Continue the search from the pin currently on this slot
+                unsigned pin = _colSol[slot];
+                DBU base = item.first - (_assignedCost[pin] - _v[slot]);
+                for (unsigned e = matrix.rowPtr[pin];
+                     e < matrix.rowPtr[pin + 1]; ++e) {
+                        unsigned next = matrix.slots[e];
+                        if (_visited[next]) continue;
+                        DBU dst = base + matrix.costs[e] - _v[next];
+                        if (dst < _d[next]) {
+                                if (_d[next] == BIG) _touched.push_back(next);
+                                _d[next] = dst;
+                                _pred[next] = pin;
+                                _predCost[next] = matrix.costs[e];
+                                _heap.push_back(HeapItem(dst, next));
+                                std::push_heap(_heap.begin(), _heap.end(),
+                                               compare);
+                        }
+                }
+        }
+
+        if (endSlot >= 0) {
+                // Update the prices of the settled slots
+                for (unsigned slot : _settled) {
+                        _v[slot] += _d[slot] - endDst;
+                }
+
+                // Augment along the alternating path
+                int slot = endSlot;
+                unsigned pin;
+                do {
+                        pin = _pred[slot];
+                        int prevSlot = rowSol[pin];
+                        _colSol[slot] = pin;
+                        rowSol[pin] = slot;
+                        _assignedCost[pin] = _predCost[slot];
+                        slot = prevSlot;
+                } while (pin != freePin);
+        }
+
+        for (unsigned slot : _touched) {
+                _d[slot] = BIG;
+                _visited[slot] = false;
+        }
+
+        return endSlot >= 0;
+}
+
+void SparseAssignmentSolver::reserve(unsigned numPins, unsigned numSlots) {
+        _v.reserve(numSlots);
+        _d.reserve(numSlots);
+        _colSol.reserve(numSlots);
+        _pred.reserve(numSlots);
+        _predCost.reserve(numSlots);
+        _assignedCost.reserve(numPins);
+        _settled.reserve(numSlots);
+        _touched.reserve(numSlots);
+        _visited.reserve(numSlots);
+        _heap.reserve(numSlots);
+}
+
+bool SparseAssignmentSolver::solve(const SparseCostMatrix& matrix,
+                                   std::vector<int>& assignment) {
+        const unsigned numPins = matrix.numPins;
+        const unsigned numSlots = matrix.numSlots;
+
+        // Slots that are never assigned keep a zero price, which keeps the
+        // prices optimal when there are more slots than pins
+        _v.assign(numSlots, 0);
+        _d.assign(numSlots, BIG);
+        _colSol.assign(numSlots, -1);
+        _pred.assign(numSlots, -1);
+        _predCost.assign(numSlots, 0);
+        _visited.assign(numSlots, false);
+        _assignedCost.assign(numPins, 0);
+        assignment.assign(numPins, -1);
+
+        for (unsigned pin = 0; pin < numPins; ++pin) {
+                if (!augment(matrix, pin, assignment)) {
+                        return false;
+                }
+        }
+
+        return true;
+}
+
+void CapacitatedAssignmentSolver::scanPin(const SparseCostMatrix& matrix,
+                                          unsigned pin, DBU base) {
+        std::greater<HeapItem> compare;
+        for (unsigned e = matrix.rowPtr[pin]; e < matrix.rowPtr[pin + 1];
+             ++e) {
+                unsigned column = matrix.slots[e];
+                if (_visited[column]) continue;
+                DBU dst = base + matrix.costs[e] - _v[column];
+                if (dst < _d[column]) {
+                        if (_d[column] == BIG) _touched.push_back(column);
+                        _d[column] = dst;
+                        _pred[column] = pin;
+                        _predCost[column] = matrix.costs[e];
+                        _heap.push_back(HeapItem(dst, column));
+                        std::push_heap(_heap.begin(), _heap.end(), compare);
+                }
+        }
+}
+
+void CapacitatedAssignmentSolver::movePin(unsigned pin, int column,
+                                          std::vector<int>& rowSol) {
+        int previous = rowSol[pin];
+        if (previous >= 0) {
+                std::vector<unsigned>& pins = _pinsOf[previous];
+                unsigned last = pins.back();
+                pins[_posInColumn[pin]] = last;
+                _posInColumn[last] = _posInColumn[pin];
+                pins.pop_back();
+        }
+        _posInColumn[pin] = _pinsOf[column].size();
+        _pinsOf[column].push_back(pin);
+        rowSol[pin] = column;
+}
+
+bool CapacitatedAssignmentSolver::augment(const SparseCostMatrix& matrix,
+                                          unsigned freePin,
+                                          std::vector<int>& rowSol) {
+        std::greater<HeapItem> compare;
+        _heap.clear();
+        _settled.clear();
+        _touched.clear();
+
+        scanPin(matrix, freePin, 0);
+
+        int endColumn = -1;
+        DBU endDst = 0;
+        while (!_heap.empty()) {
+                std::pop_heap(_heap.begin(), _heap.end(), compare);
+                HeapItem item = _heap.back();
+                _heap.pop_back();
+                unsigned column = item.second;
+                if (_visited[column] || item.first > _d[column]) continue;
+                _visited[column] = true;
+
+                if (_pinsOf[column].size() < _capacity[column]) {
+                        endColumn = column;
+                        endDst = item.first;
+                        break;
+                }
+                _settled.push_back(column);
+
+                // Any pin of a full column may move on to another column
+                for (unsigned pin : _pinsOf[column]) {
+                        scanPin(matrix, pin,
+                                item.first -
+                                    (_assignedCost[pin] - _v[column]));
+                }
+        }
+
+        if (endColumn >= 0) {
+                for (unsigned column : _settled) {
+                        _v[column] += _d[column] - endDst;
+                }
+
+                // Each pin on the path moves to the column it reached,
+                // freeing its place for the previous pin of the path
+                int column = endColumn;
+                unsigned pin;
+                do {
+                        pin = _pred[column];
+                        int prevColumn = rowSol[pin];
+                        _assignedCost[pin] = _predCost[column];
+                        movePin(pin, column, rowSol);
+                        column = prevColumn;
+                } while (pin != freePin);
+        }
+
+        for (unsigned column : _touched) {
+                _d[column] = BIG;
+                _visited[column] = false;
+        }
+
+        return endColumn >= 0;
+}
+
+bool CapacitatedAssignmentSolver::solve(const SparseCostMatrix& matrix,
+                                        const std::vector<unsigned>& capacities,
+                                        std::vector<int>& assignment) {
+        const unsigned numPins = matrix.numPins;
+        const unsigned numColumns = matrix.numSlots;
+
+        // Columns below their capacity are never settled and keep a zero
+        // price, as the free slots of SparseAssignmentSolver
+        _v.assign(numColumns, 0);
+        _d.assign(numColumns, BIG);
+        _capacity = capacities;
+        _pinsOf.assign(numColumns, std::vector<unsigned>());
+        _posInColumn.assign(numPins, 0);
+        _pred.assign(numColumns, -1);
+        _predCost.assign(numColumns, 0);
+        _visited.assign(numColumns, false);
+        _assignedCost.assign(numPins, 0);
+        assignment.assign(numPins, -1);
+
+        for (unsigned pin = 0; pin < numPins; ++pin) {
+                if (!augment(matrix, pin, assignment)) {
+                        return false;
+                }
+        }
+
+        return true;
+}
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SPARSEASSIGNMENT_H_
+#define __SPARSEASSIGNMENT_H_
+
+#include <utility>
+#include <vector>
+
+#include "Coordinate.h"
+
+// Candidate slots of each pin in compressed sparse row format: the
+// candidates of pin i are at [rowPtr[i], rowPtr[i + 1]) of slots and costs
+struct SparseCostMatrix {
+        unsigned numPins = 0;
+        unsigned numSlots = 0;
+        std::vector<unsigned> rowPtr;
+        std::vector<unsigned> slots;
+        std::vector<DBU> costs;
+
+        void clear(unsigned, unsigned);
+        void addPin(const std::vector<unsigned>&, const std::vector<DBU>&);
+};
+
+// Shortest augmenting path solver over the candidate edges only. Each free pin
+// runs a Dijkstra search (with slot prices keeping the reduced costs
+// non-negative) until it reaches a free slot.
+class SparseAssignmentSolver {
+       private:
+        typedef std::pair<DBU, unsigned> HeapItem;
+
+        std::vector<DBU> _v;
+        std::vector<DBU> _d;
+        std::vector<int> _colSol;
+        std::vector<int> _pred;
+        std::vector<DBU> _predCost;
+        std::vector<DBU> _assignedCost;
+        std::vector<unsigned> _settled;
+        std::vector<unsigned> _touched;
+        std::vector<bool> _visited;
+        std::vector<HeapItem> _heap;
+
+        bool augment(const SparseCostMatrix&, unsigned, std::vector<int>&);
+
+       public:
+        void reserve(unsigned numPins, unsigned numSlots);
+        // Returns false when some pin cannot be assigned using only the
+        // candidate slots. On success, assignment[pin] is the slot index.
+        bool solve(const SparseCostMatrix&, std::vector<int>& assignment);
+};
+
+// Same search for columns that take several pins (min-cost flow with unit
+// supplies): a column is a free end while its load is below its capacity,
+// and a full column continues the search from every pin it holds. Used to
+// assign pins to sections, with the candidate sections of each pin as
+// columns.
+class CapacitatedAssignmentSolver {
+       private:
+        typedef std::pair<DBU, unsigned> HeapItem;
+
+        std::vector<DBU> _v;
+        std::vector<DBU> _d;
+        std::vector<unsigned> _capacity;
+        std::vector<std::vector<unsigned>> _pinsOf;
+        std::vector<unsigned> _posInColumn;
+        std::vector<int> _pred;
+        std::vector<DBU> _predCost;
+        std::vector<DBU> _assignedCost;
+        std::vector<unsigned> _settled;
+        std::vector<unsigned> _touched;
+        std::vector<bool> _visited;
+        std::vector<HeapItem> _heap;
+
+        void scanPin(const SparseCostMatrix&, unsigned pin, DBU base);
+        void movePin(unsigned pin, int column, std::vector<int>&);
+        bool augment(const SparseCostMatrix&, unsigned, std::vector<int>&);
+
+       public:
+        // Returns false when some pin cannot be assigned using only its
+        // candidate columns. On success, assignment[pin] is the column.
+        bool solve(const SparseCostMatrix&,
+                   const std::vector<unsigned>& capacities,
+                   std::vector<int>& assignment);
+};
+
+#endif /* __SPARSEASSIGNMENT_H_ */
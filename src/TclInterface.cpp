@@ -190,3 +190,75 @@ void   set_rand_seed(double seed){
 double get_rand_seed(){
         return parmsToIOPlacer->getRandSeed();
 }
+
+void set_assignment_solver(int solver){
+        parmsToIOPlacer->setAssignmentSolver(solver);
+}
+
+int get_assignment_solver(){
+        return parmsToIOPlacer->getAssignmentSolver();
+}
+
+void set_num_candidates(int candidates){
+        parmsToIOPlacer->setNumCandidates(candidates);
+}
+
+int get_num_candidates(){
+        return parmsToIOPlacer->getNumCandidates();
+}
+
+void set_warm_start(bool enable){
+        parmsToIOPlacer->setWarmStart(enable);
+}
+
+bool get_warm_start(){
+        return parmsToIOPlacer->getWarmStart();
+}
+
+void set_warm_start_file(const char* file){
+        parmsToIOPlacer->setWarmStartFile(file);
+}
+
+const char* get_warm_start_file(){
+        return parmsToIOPlacer->getWarmStartFile().c_str();
+}
+
+void set_compact_costs(bool enable){
+        parmsToIOPlacer->setCompactCosts(enable);
+}
+
+bool get_compact_costs(){
+        return parmsToIOPlacer->getCompactCosts();
+}
+
+void set_cluster_size(int size){
+        parmsToIOPlacer->setClusterSize(size);
+}
+
+int get_cluster_size(){
+        return parmsToIOPlacer->getClusterSize();
+}
+
+void set_flow_sections(int num){
+        parmsToIOPlacer->setFlowSections(num);
+}
+
+int get_flow_sections(){
+        return parmsToIOPlacer->getFlowSections();
+}
+
+void set_refine_window(int window){
+        parmsToIOPlacer->setRefineWindow(window);
+}
+
+int get_refine_window(){
+        return parmsToIOPlacer->getRefineWindow();
+}
+
+void set_perimeter_solver(bool enable){
+        parmsToIOPlacer->setPerimeterSolver(enable);
+}
+
+bool get_perimeter_solver(){
+        return parmsToIOPlacer->getPerimeterSolver();
+}
@@ -75,6 +75,24 @@ void   set_num_threads(int numThreads);
 int    get_num_threads();
 void   set_rand_seed(double seed);
 double get_rand_seed();
+void   set_assignment_solver(int solver);
+int    get_assignment_solver();
+void   set_num_candidates(int candidates);
+int    get_num_candidates();
+void   set_warm_start(bool enable);
+bool   get_warm_start();
+void   set_warm_start_file(const char* file);
+const char* get_warm_start_file();
+void   set_compact_costs(bool enable);
+bool   get_compact_costs();
+void   set_cluster_size(int size);
+int    get_cluster_size();
+void   set_flow_sections(int num);
+int    get_flow_sections();
+void   set_refine_window(int window);
+int    get_refine_window();
+void   set_perimeter_solver(bool enable);
+bool   get_perimeter_solver();
 
 // flow
 void run_io_placement();
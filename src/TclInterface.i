@@ -75,3 +75,21 @@ extern void  set_num_threads(int numThreads);
 extern int   get_num_threads();
 extern void   set_rand_seed(double seed);
 extern double get_rand_seed();
+extern void   set_assignment_solver(int solver);
+extern int    get_assignment_solver();
+extern void   set_num_candidates(int candidates);
+extern int    get_num_candidates();
+extern void   set_warm_start(bool enable);
+extern bool   get_warm_start();
+extern void   set_warm_start_file(const char* file);
+extern const char* get_warm_start_file();
+extern void   set_compact_costs(bool enable);
+extern bool   get_compact_costs();
+extern void   set_cluster_size(int size);
+extern int    get_cluster_size();
+extern void   set_flow_sections(int num);
+extern int    get_flow_sections();
+extern void   set_refine_window(int window);
+extern int    get_refine_window();
+extern void   set_perimeter_solver(bool enable);
+extern bool   get_perimeter_solver();
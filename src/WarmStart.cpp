@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "WarmStart.h"
+
+#include <fstream>
+
+void WarmStart::add(const std::string& pinName, const Coordinate& pos,
+                    DBU price) {
+        Entry entry = {pos.getX(), pos.getY(), price};
+        _pins[pinName] = entry;
+}
+
+bool WarmStart::find(const std::string& pinName, Coordinate& pos,
+                     DBU& price) const {
+        auto it = _pins.find(pinName);
+        if (it == _pins.end()) {
+                return false;
+        }
+        pos.init(it->second.x, it->second.y);
+        price = it->second.price;
+        return true;
+}
+
+bool WarmStart::read(const std::string& file) {
+        std::ifstream in(file);
+        if (not in.is_open()) {
+                return false;
+        }
+
+        clear();
+        std::string pinName;
+        Entry entry;
+        while (in >> pinName >> entry.x >> entry.y >> entry.price) {
+                // Positions out of range cannot be on a slot
+                if (fitsCoordinateWidth(entry.x, entry.y)) {
+                        _pins[pinName] = entry;
+                }
+        }
+        return true;
+}
+
+bool WarmStart::write(const std::string& file) const {
+        std::ofstream out(file);
+        if (not out.is_open()) {
+                return false;
+        }
+
+        for (const auto& pin : _pins) {
+                out << pin.first << " " << pin.second.x << " " << pin.second.y
+                    << " " << pin.second.price << "\n";
+        }
+        return out.good();
+}
@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////
+// Authors: Vitor Bandeira, Mateus Fogaça, Eder Matheus Monteiro e Isadora
+// Oliveira
+//          (Advisor: Ricardo Reis)
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2019, Federal University of Rio Grande do Sul (UFRGS)
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WARMSTART_H_
+#define __WARMSTART_H_
+
+#include <string>
+#include <unordered_map>
+
+#include "Coordinate.h"
+
+// Final matching and dual prices of a previous run. Each pin keeps the
+// position of its slot and the price (column reduction) of that slot; slots
+// left free always end with price zero, so they are not stored. The row
+// reductions are implied by the prices and are recomputed on the next solve.
+class WarmStart {
+       private:
+        struct Entry {
+                DBU x;
+                DBU y;
+                DBU price;
+        };
+        std::unordered_map<std::string, Entry> _pins;
+
+       public:
+        void clear() { _pins.clear(); }
+        bool empty() const { return _pins.empty(); }
+        unsigned size() const { return _pins.size(); }
+
+        void add(const std::string&, const Coordinate&, DBU);
+        bool find(const std::string&, Coordinate&, DBU&) const;
+
+        // Text file, one "pinName x y price" line per pin
+        bool read(const std::string&);
+        bool write(const std::string&) const;
+};
+
+#endif /* __WARMSTART_H_ */
@@ -94,9 +94,11 @@ bool WriterIOPins::writeFile() {
                                 return false;
                         }
 
-                        for (IOPin ioPin : assignment) {
-                                std::string name = ioPin.getName();
-                                std::string netName = ioPin.getNetName();
+                        for (const IOPin& ioPin : assignment) {
+                                const std::string& name =
+                                    _netlist.getName(ioPin.getName());
+                                const std::string& netName =
+                                    _netlist.getName(ioPin.getNetName());
                                 Direction direction = ioPin.getDirection();
                                 std::string layer;
 
@@ -126,8 +128,10 @@ bool WriterIOPins::writeFile() {
                                 }
 
                                 std::string locationType;
-                                if (ioPin.getLocationType() != "INVALID_STRING*") {
-                                        locationType = ioPin.getLocationType();
+                                const std::string& pinLocationType =
+                                    _netlist.getName(ioPin.getLocationType());
+                                if (pinLocationType != "INVALID_STRING*") {
+                                        locationType = pinLocationType;
                                 } else  {
                                         locationType = "FIXED";
                                 }
@@ -0,0 +1,14 @@
+import_lef ../test_hpwl/input.lef
+import_def ../test_hpwl/input.def
+
+set_hor_metal_layer 2
+set_ver_metal_layer 3
+
+set_num_threads 5
+set_blockages_file "blockages.txt"
+
+run_io_placement
+
+export_def "result.def"
+ 
+exit
@@ -0,0 +1,37 @@
+#!/usr/bin/env bash
+
+if [ "$#" -ne 1 ]; then
+	exit 2
+fi
+
+binary=$1
+
+$binary -c 1 < ioPlacer.tcl > log.txt 2>&1
+
+if [ ! -e result.def ]
+then
+	exit 2
+fi
+
+# blockages.txt covers the bottom left corner up to x = 100000 and
+# y = 1000, so no pin of the PINS section may be placed inside it
+read -r min_x min_y max_x max_y < blockages.txt
+
+awk -v min_x=$min_x -v min_y=$min_y -v max_x=$max_x -v max_y=$max_y '
+/^PINS/ { pins = 1 }
+/^END PINS/ { pins = 0 }
+pins && $2 == "PLACED" {
+	placed++
+	if ($4 >= min_x && $4 <= max_x && $5 >= min_y && $5 <= max_y) {
+		blocked++
+	}
+}
+END { exit (placed == 0 || blocked > 0) }
+' result.def
+
+if [ $? -eq 0 ]
+then
+	exit 0
+else
+	exit 2
+fi
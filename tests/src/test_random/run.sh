@@ -0,0 +1,46 @@
+#!/usr/bin/env bash
+
+if [ "$#" -ne 1 ]; then
+	exit 2
+fi
+
+binary=$1
+
+# Places the pins with random mode $1 on $2 threads and keeps the PINS
+# section of the exported DEF
+run_placement() {
+	name=random_$1_$2
+	cat > ioPlacer_$name.tcl <<TCL
+import_lef ../test_hpwl/input.lef
+import_def ../test_hpwl/input.def
+
+set_hor_metal_layer 2
+set_ver_metal_layer 3
+
+set_num_threads $2
+set_random_mode $1
+set_rand_seed 42
+
+run_io_placement
+
+export_def "result_$name.def"
+
+exit
+TCL
+	$binary -c 1 < ioPlacer_$name.tcl > log_$name.txt 2>&1
+	sed -n '/^PINS/,/^END PINS/p' result_$name.def > pins_$name.def
+}
+
+# The same seed must give the same pins whatever the thread count
+for mode in 1 2 3; do
+	run_placement $mode 1
+	run_placement $mode 4
+
+	if [ ! -s pins_random_${mode}_1.def ] ||
+	   ! cmp -s pins_random_${mode}_1.def pins_random_${mode}_4.def
+	then
+		exit 2
+	fi
+done
+
+exit 0
@@ -0,0 +1,95 @@
+#!/usr/bin/env bash
+
+if [ "$#" -ne 1 ]; then
+	exit 2
+fi
+
+binary=$1
+
+# Runs ioPlacer with the solver options in $2 and prints the final HPWL
+run_placement() {
+	cat > ioPlacer_$1.tcl <<TCL
+import_lef ../test_hpwl/input.lef
+import_def ../test_hpwl/input.def
+
+set_hor_metal_layer 2
+set_ver_metal_layer 3
+
+set_num_threads 5
+$2
+
+run_io_placement
+
+puts "Final HPWL [compute_io_nets_hpwl]"
+
+exit
+TCL
+	$binary -c 1 < ioPlacer_$1.tcl > log_$1.txt 2>&1
+	grep "Final HPWL" log_$1.txt | awk '{print $3}'
+}
+
+# Reference run with the default solver, checked against the golden
+ref_hpwl=$(run_placement munkres "")
+golden_hpwl=$(grep "Final HPWL" ../test_hpwl/golden.txt |  awk '{print $3}')
+
+if [ -z "$ref_hpwl" ]; then
+	exit 2
+fi
+
+upper_limit=$(echo "${golden_hpwl} * 1.05" | bc | cut -f1 -d.)
+lower_limit=$(echo "${golden_hpwl} * 0.95" | bc | cut -f1 -d.)
+
+if [ $ref_hpwl -le $lower_limit ] || [ $ref_hpwl -ge $upper_limit ]; then
+	exit 2
+fi
+
+upper_limit=$(echo "${ref_hpwl} * 1.05" | bc | cut -f1 -d.)
+lower_limit=$(echo "${ref_hpwl} * 0.95" | bc | cut -f1 -d.)
+
+# name|options|check, where check is:
+#   equal  exact solvers, same HPWL as the reference
+#   le     refinements of the reference, never worse
+#   near   heuristics, within 5% of the reference
+modes=(
+	"lapjv|set_assignment_solver 1|equal"
+	"auction|set_assignment_solver 2|equal"
+	"refine|set_refine_window 50|le"
+	"perimeter|set_perimeter_solver 1|le"
+	"candidates|set_num_candidates 8|near"
+	"flow|set_flow_sections 4|near"
+	"cluster|set_cluster_size 8|near"
+)
+
+status=0
+for mode in "${modes[@]}"; do
+	IFS="|" read -r name options check <<< "$mode"
+	hpwl=$(run_placement $name "$options")
+
+	if [ -z "$hpwl" ]; then
+		echo "$name: no HPWL reported" >> check_log.txt
+		exit 2
+	fi
+	echo "$name: $hpwl (reference $ref_hpwl)" >> check_log.txt
+
+	case $check in
+	equal)
+		if [ $hpwl -ne $ref_hpwl ]; then
+			exit 2
+		fi
+		;;
+	le)
+		if [ $hpwl -gt $ref_hpwl ]; then
+			exit 2
+		fi
+		;;
+	near)
+		if [ $hpwl -le $lower_limit ] || [ $hpwl -ge $upper_limit ]; then
+			exit 2
+		elif [ $hpwl -ne $ref_hpwl ]; then
+			status=1
+		fi
+		;;
+	esac
+done
+
+exit $status
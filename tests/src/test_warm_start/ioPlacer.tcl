@@ -0,0 +1,15 @@
+import_lef ../test_hpwl/input.lef
+import_def ../test_hpwl/input.def
+
+set_hor_metal_layer 2
+set_ver_metal_layer 3
+
+set_num_threads 5
+set_assignment_solver 1
+set_warm_start_file "warm_start.txt"
+
+run_io_placement
+
+puts "Final HPWL [compute_io_nets_hpwl]"
+ 
+exit
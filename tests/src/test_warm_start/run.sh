@@ -0,0 +1,25 @@
+#!/usr/bin/env bash
+
+if [ "$#" -ne 1 ]; then
+	exit 2
+fi
+
+binary=$1
+
+# The first run saves the warm start, the second one solves from it
+rm -f warm_start.txt
+$binary -c 1 < ioPlacer.tcl > log_cold.txt 2>&1
+$binary -c 1 < ioPlacer.tcl > log_warm.txt 2>&1
+
+cold_hpwl=$(grep "Final HPWL" log_cold.txt |  awk '{print $3}')
+warm_hpwl=$(grep "Final HPWL" log_warm.txt |  awk '{print $3}')
+
+if [ ! -s warm_start.txt ] || [ -z "$cold_hpwl" ]
+then
+	exit 2
+elif [ "$warm_hpwl" == "$cold_hpwl" ]
+then
+	exit 0
+else
+	exit 2
+fi
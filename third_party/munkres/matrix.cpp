@@ -21,25 +21,46 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
+#include <new>
+
+/*export*/ template <class T>
+T *Matrix<T>::allocate(const size_t size) {
+        void *ptr = nullptr;
+        if (posix_memalign(&ptr, ALIGNMENT, std::max<size_t>(size, 1) *
+                                                sizeof(T)) != 0) {
+                throw std::bad_alloc();
+        }
+        return static_cast<T *>(ptr);
+}
+
+/*export*/ template <class T>
+void Matrix<T>::release() {
+        std::free(m_data);
+        m_data = nullptr;
+        m_rows = 0;
+        m_columns = 0;
+        m_capacity = 0;
+}
 
 /*export*/ template <class T>
 Matrix<T>::Matrix() {
         m_rows = 0;
         m_columns = 0;
-        m_matrix = nullptr;
+        m_capacity = 0;
+        m_data = nullptr;
 }
 
 /*export*/ template <class T>
 Matrix<T>::Matrix(const std::initializer_list<std::initializer_list<T>> init) {
-        m_matrix = nullptr;
-        m_rows = init.size();
-        if (m_rows == 0) {
-                m_columns = 0;
-        } else {
-                m_columns = init.begin()->size();
-                if (m_columns > 0) {
-                        resize(m_rows, m_columns);
-                }
+        m_data = nullptr;
+        m_rows = 0;
+        m_columns = 0;
+        m_capacity = 0;
+        size_t rows = init.size();
+        size_t columns = rows == 0 ? 0 : init.begin()->size();
+        if (rows > 0 && columns > 0) {
+                resize(rows, columns);
         }
 
         size_t i = 0, j;
@@ -49,72 +70,84 @@ Matrix<T>::Matrix(const std::initializer_list<std::initializer_list<T>> init) {
                 j = 0;
                 for (auto value = row->begin(); value != row->end();
                      ++value, ++j) {
-                        m_matrix[i][j] = *value;
+                        (*this)(i, j) = *value;
                 }
         }
 }
 
 /*export*/ template <class T>
 Matrix<T>::Matrix(const Matrix<T> &other) {
-        if (other.m_matrix != nullptr) {
-                // copy arrays
-                m_matrix = nullptr;
-                resize(other.m_rows, other.m_columns);
-                for (size_t i = 0; i < m_rows; i++) {
-                        for (size_t j = 0; j < m_columns; j++) {
-                                m_matrix[i][j] = other.m_matrix[i][j];
-                        }
-                }
-        } else {
-                m_matrix = nullptr;
-                m_rows = 0;
-                m_columns = 0;
-        }
+        m_data = nullptr;
+        m_rows = 0;
+        m_columns = 0;
+        m_capacity = 0;
+        *this = other;
+}
+
+/*export*/ template <class T>
+Matrix<T>::Matrix(Matrix<T> &&other) noexcept {
+        m_data = other.m_data;
+        m_rows = other.m_rows;
+        m_columns = other.m_columns;
+        m_capacity = other.m_capacity;
+        other.m_data = nullptr;
+        other.m_rows = 0;
+        other.m_columns = 0;
+        other.m_capacity = 0;
 }
 
 /*export*/ template <class T>
 Matrix<T>::Matrix(const size_t rows, const size_t columns) {
-        m_matrix = nullptr;
+        m_data = nullptr;
+        m_rows = 0;
+        m_columns = 0;
+        m_capacity = 0;
         resize(rows, columns);
 }
 
 /*export*/ template <class T>
 Matrix<T> &Matrix<T>::operator=(const Matrix<T> &other) {
-        if (other.m_matrix != nullptr) {
-                // copy arrays
-                resize(other.m_rows, other.m_columns);
-                for (size_t i = 0; i < m_rows; i++) {
-                        for (size_t j = 0; j < m_columns; j++) {
-                                m_matrix[i][j] = other.m_matrix[i][j];
-                        }
-                }
-        } else {
-                // free arrays
-                for (size_t i = 0; i < m_columns; i++) {
-                        delete[] m_matrix[i];
-                }
-
-                delete[] m_matrix;
+        if (this == &other) {
+                return *this;
+        }
+        if (other.m_data == nullptr) {
+                release();
+                return *this;
+        }
 
-                m_matrix = nullptr;
-                m_rows = 0;
-                m_columns = 0;
+        const size_t size = other.m_rows * other.m_columns;
+        if (size > m_capacity) {
+                std::free(m_data);
+                m_data = allocate(size);
+                m_capacity = size;
         }
+        std::memcpy(m_data, other.m_data, size * sizeof(T));
+        m_rows = other.m_rows;
+        m_columns = other.m_columns;
 
         return *this;
 }
 
 /*export*/ template <class T>
-Matrix<T>::~Matrix() {
-        if (m_matrix != nullptr) {
-                // free arrays
-                for (size_t i = 0; i < m_rows; i++) {
-                        delete[] m_matrix[i];
-                }
-
-                delete[] m_matrix;
+Matrix<T> &Matrix<T>::operator=(Matrix<T> &&other) noexcept {
+        if (this != &other) {
+                std::free(m_data);
+                m_data = other.m_data;
+                m_rows = other.m_rows;
+                m_columns = other.m_columns;
+                m_capacity = other.m_capacity;
+                other.m_data = nullptr;
+                other.m_rows = 0;
+                other.m_columns = 0;
+                other.m_capacity = 0;
         }
-        m_matrix = nullptr;
+        return *this;
+}
+
+/*export*/ template <class T>
+Matrix<T>::~Matrix() {
+        std::free(m_data);
+        m_data = nullptr;
 }
 
 /*export*/ template <class T>
@@ -122,108 +155,128 @@ void Matrix<T>::resize(const size_t rows, const size_t columns,
                        const T default_value) {
         assert(rows > 0 && columns > 0 && "Columns and rows must exist.");
 
-        if (m_matrix == nullptr) {
-                // alloc arrays
-                m_matrix = new T *[rows];  // rows
-                for (size_t i = 0; i < rows; i++) {
-                        m_matrix[i] = new T[columns];  // columns
-                }
-
+        if (m_data == nullptr) {
+                m_data = allocate(rows * columns);
+                m_capacity = rows * columns;
                 m_rows = rows;
                 m_columns = columns;
                 clear();
-        } else {
-                // save array pointer
-                T **new_matrix;
-                // alloc new arrays
-                new_matrix = new T *[rows];  // rows
-                for (size_t i = 0; i < rows; i++) {
-                        new_matrix[i] = new T[columns];  // columns
-                        for (size_t j = 0; j < columns; j++) {
-                                new_matrix[i][j] = default_value;
+                return;
+        }
+
+        const size_t minrows = std::min(rows, m_rows);
+        if (rows * columns <= m_capacity) {
+                // Move the kept rows within the buffer: wider rows move
+                // forward, so start from the last one; narrower rows move
+                // backward, so start from the first one
+                if (columns > m_columns) {
+                        for (size_t x = minrows; x-- > 0;) {
+                                T *row = m_data + x * columns;
+                                std::memmove(row, m_data + x * m_columns,
+                                             m_columns * sizeof(T));
+                                std::fill(row + m_columns, row + columns,
+                                          default_value);
+                        }
+                } else if (columns < m_columns) {
+                        for (size_t x = 0; x < minrows; x++) {
+                                std::memmove(m_data + x * columns,
+                                             m_data + x * m_columns,
+                                             columns * sizeof(T));
                         }
                 }
+                std::fill(m_data + minrows * columns, m_data + rows * columns,
+                          default_value);
+                m_rows = rows;
+                m_columns = columns;
+                return;
+        }
 
-                // copy data from saved pointer to new arrays
-                size_t minrows = std::min(rows, m_rows);
-                size_t mincols = std::min(columns, m_columns);
-                for (size_t x = 0; x < minrows; x++) {
-                        for (size_t y = 0; y < mincols; y++) {
-                                new_matrix[x][y] = m_matrix[x][y];
-                        }
+        // alloc new array and copy the overlapping part
+        T *new_data = allocate(rows * columns);
+        size_t mincols = std::min(columns, m_columns);
+        for (size_t x = 0; x < rows; x++) {
+                for (size_t y = 0; y < columns; y++) {
+                        new_data[x * columns + y] =
+                            (x < minrows && y < mincols)
+                                ? m_data[x * m_columns + y]
+                                : default_value;
                 }
+        }
 
-                // delete old arrays
-                if (m_matrix != nullptr) {
-                        for (size_t i = 0; i < m_rows; i++) {
-                                delete[] m_matrix[i];
-                        }
+        std::free(m_data);
+        m_data = new_data;
+        m_capacity = rows * columns;
+        m_rows = rows;
+        m_columns = columns;
+}
 
-                        delete[] m_matrix;
-                }
+/*export*/ template <class T>
+void Matrix<T>::assign(const size_t rows, const size_t columns,
+                       const T value) {
+        assert(rows > 0 && columns > 0 && "Columns and rows must exist.");
 
-                m_matrix = new_matrix;
+        if (rows * columns > m_capacity) {
+                std::free(m_data);
+                m_data = allocate(rows * columns);
+                m_capacity = rows * columns;
         }
-
         m_rows = rows;
         m_columns = columns;
+        std::fill(m_data, m_data + rows * columns, value);
 }
 
 /*export*/ template <class T>
-void Matrix<T>::clear() {
-        assert(m_matrix != nullptr);
+void Matrix<T>::reserve(const size_t size) {
+        if (size <= m_capacity) {
+                return;
+        }
 
-        for (size_t i = 0; i < m_rows; i++) {
-                for (size_t j = 0; j < m_columns; j++) {
-                        m_matrix[i][j] = 0;
-                }
+        T *new_data = allocate(size);
+        if (m_data != nullptr) {
+                std::memcpy(new_data, m_data, m_rows * m_columns * sizeof(T));
         }
+        std::free(m_data);
+        m_data = new_data;
+        m_capacity = size;
+}
+
+/*export*/ template <class T>
+void Matrix<T>::clear() {
+        assert(m_data != nullptr);
+
+        std::fill(m_data, m_data + m_rows * m_columns, T(0));
 }
 
 /*export*/ template <class T>
 inline T &Matrix<T>::operator()(const size_t x, const size_t y) {
         assert(x < m_rows);
         assert(y < m_columns);
-        assert(m_matrix != nullptr);
-        return m_matrix[x][y];
+        assert(m_data != nullptr);
+        return m_data[x * m_columns + y];
 }
 
 /*export*/ template <class T>
 inline const T &Matrix<T>::operator()(const size_t x, const size_t y) const {
         assert(x < m_rows);
         assert(y < m_columns);
-        assert(m_matrix != nullptr);
-        return m_matrix[x][y];
+        assert(m_data != nullptr);
+        return m_data[x * m_columns + y];
 }
 
 /*export*/ template <class T>
 const T Matrix<T>::min() const {
-        assert(m_matrix != nullptr);
+        assert(m_data != nullptr);
         assert(m_rows > 0);
         assert(m_columns > 0);
-        T min = m_matrix[0][0];
-
-        for (size_t i = 0; i < m_rows; i++) {
-                for (size_t j = 0; j < m_columns; j++) {
-                        min = std::min<T>(min, m_matrix[i][j]);
-                }
-        }
 
-        return min;
+        return *std::min_element(m_data, m_data + m_rows * m_columns);
 }
 
 /*export*/ template <class T>
 const T Matrix<T>::max() const {
-        assert(m_matrix != nullptr);
+        assert(m_data != nullptr);
         assert(m_rows > 0);
         assert(m_columns > 0);
-        T max = m_matrix[0][0];
-
-        for (size_t i = 0; i < m_rows; i++) {
-                for (size_t j = 0; j < m_columns; j++) {
-                        max = std::max<T>(max, m_matrix[i][j]);
-                }
-        }
 
-        return max;
+        return *std::max_element(m_data, m_data + m_rows * m_columns);
 }
@@ -22,19 +22,33 @@
 #include <initializer_list>
 #include <cstdlib>
 #include <ostream>
+#include <type_traits>
 
+// Row-major matrix stored in a single contiguous buffer aligned to a cache
+// line. Moving a matrix only transfers the buffer.
 template <class T>
 class Matrix {
+        static_assert(std::is_trivial<T>::value,
+                      "Matrix elements are copied as raw memory.");
+
        public:
+        static constexpr size_t ALIGNMENT = 64;
+
         Matrix();
         Matrix(const size_t rows, const size_t columns);
         Matrix(const std::initializer_list<std::initializer_list<T>> init);
         Matrix(const Matrix<T>& other);
+        Matrix(Matrix<T>&& other) noexcept;
         Matrix<T>& operator=(const Matrix<T>& other);
+        Matrix<T>& operator=(Matrix<T>&& other) noexcept;
         ~Matrix();
         // all operations modify the matrix in-place.
         void resize(const size_t rows, const size_t columns,
                     const T default_value = 0);
+        // reshape to rows x columns filled with value, dropping the contents
+        void assign(const size_t rows, const size_t columns, const T value);
+        // make room for size elements, so that smaller shapes never allocate
+        void reserve(const size_t size);
         void clear();
         T& operator()(const size_t x, const size_t y);
         const T& operator()(const size_t x, const size_t y) const;
@@ -45,6 +59,13 @@ class Matrix {
         }
         inline size_t columns() const { return m_columns; }
         inline size_t rows() const { return m_rows; }
+        inline size_t capacity() const { return m_capacity; }
+        inline T* data() { return m_data; }
+        inline const T* data() const { return m_data; }
+        inline T* row(const size_t x) { return m_data + x * m_columns; }
+        inline const T* row(const size_t x) const {
+                return m_data + x * m_columns;
+        }
 
         friend std::ostream& operator<<(std::ostream& os,
                                         const Matrix& matrix) {
@@ -60,9 +81,13 @@ class Matrix {
         }
 
        private:
-        T** m_matrix;
+        T* m_data;
         size_t m_rows;
         size_t m_columns;
+        size_t m_capacity;
+
+        static T* allocate(const size_t size);
+        void release();
 };
 
 #ifndef USE_EXPORT_KEYWORD
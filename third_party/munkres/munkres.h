@@ -22,7 +22,7 @@
 
 #include "matrix.h"
 
-#include <list>
+#include <vector>
 #include <utility>
 #include <iostream>
 #include <cmath>
@@ -35,6 +35,18 @@ class Munkres {
         static constexpr int PRIME = 2;
 
        public:
+        /*
+         * Allocate the buffers for problems up to size x size, so that
+         * later calls to solve do not allocate. The input matrix of solve
+         * should have the same capacity to be padded in place.
+         */
+        void reserve(const size_t size) {
+                mask_matrix.reserve(size * size);
+                row_mask.reserve(size);
+                col_mask.reserve(size);
+                seq.reserve(2 * size + 1);
+        }
+
         /*
          *
          * Linear assignment problem solution
@@ -53,8 +65,8 @@ class Munkres {
 // std::cout << "Munkres input: " << m << std::endl;
 #endif
 
-                // Copy input matrix
-                this->matrix = m;
+                // Solve in place: take over the input buffer
+                this->matrix = std::move(m);
 
                 if (rows != columns) {
                         // If the input matrix isn't square, make it square
@@ -65,17 +77,10 @@ class Munkres {
                 }
 
                 // STAR == 1 == starred, PRIME == 2 == primed
-                mask_matrix.resize(size, size);
-
-                row_mask = new bool[size];
-                col_mask = new bool[size];
-                for (size_t i = 0; i < size; i++) {
-                        row_mask[i] = false;
-                }
+                mask_matrix.assign(size, size, NORMAL);
 
-                for (size_t i = 0; i < size; i++) {
-                        col_mask[i] = false;
-                }
+                row_mask.assign(size, false);
+                col_mask.assign(size, false);
 
                 // Prepare the matrix values...
 
@@ -132,10 +137,7 @@ class Munkres {
                 // input to a square matrix.
                 matrix.resize(rows, columns);
 
-                m = matrix;
-
-                delete[] row_mask;
-                delete[] col_mask;
+                m = std::move(matrix);
         }
 
         static void replace_infinites(Matrix<Data> &matrix) {
@@ -232,11 +234,9 @@ class Munkres {
 
         bool pair_in_list(
             const std::pair<size_t, size_t> &needle,
-            const std::list<std::pair<size_t, size_t> > &haystack) {
-                for (std::list<std::pair<size_t, size_t> >::const_iterator i =
-                         haystack.begin();
-                     i != haystack.end(); i++) {
-                        if (needle == *i) {
+            const std::vector<std::pair<size_t, size_t> > &haystack) {
+                for (const std::pair<size_t, size_t> &item : haystack) {
+                        if (needle == item) {
                                 return true;
                         }
                 }
@@ -332,10 +332,10 @@ class Munkres {
                 // seq contains pairs of row/column values where we have found
                 // either a star or a prime that is part of the ``alternating
                 // sequence``.
-                std::list<std::pair<size_t, size_t> > seq;
+                seq.clear();
                 // use saverow, savecol from step 3.
                 std::pair<size_t, size_t> z0(saverow, savecol);
-                seq.insert(seq.end(), z0);
+                seq.push_back(z0);
 
                 // We have to find these two pairs:
                 std::pair<size_t, size_t> z1(-1, -1);
@@ -369,7 +369,7 @@ class Munkres {
                                         }
 
                                         madepair = true;
-                                        seq.insert(seq.end(), z1);
+                                        seq.push_back(z1);
                                         break;
                                 }
                         }
@@ -386,13 +386,13 @@ class Munkres {
                                                 continue;
                                         }
                                         madepair = true;
-                                        seq.insert(seq.end(), z2n);
+                                        seq.push_back(z2n);
                                         break;
                                 }
                         }
                 } while (madepair);
 
-                for (std::list<std::pair<size_t, size_t> >::iterator i =
+                for (std::vector<std::pair<size_t, size_t> >::iterator i =
                          seq.begin();
                      i != seq.end(); i++) {
                         // 2. Unstar each starred zero of the sequence.
@@ -473,8 +473,9 @@ class Munkres {
 
         Matrix<int> mask_matrix;
         Matrix<Data> matrix;
-        bool *row_mask;
-        bool *col_mask;
+        std::vector<char> row_mask;
+        std::vector<char> col_mask;
+        std::vector<std::pair<size_t, size_t> > seq;
         size_t saverow = 0, savecol = 0;
 };
 